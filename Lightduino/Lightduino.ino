@@ -1,5 +1,7 @@
 #include <SPI.h>
 #include <Adafruit_WS2801.h>
+#include <WS2801Strip.h>
+#include <WS2801Effects.h>
 #include <IRLib.h>
 #include <U8glib.h>
 
@@ -11,6 +13,9 @@
 #define PIN_WS2801_CLOCK     7
 #define PIN_LASER_POINTER    8
 
+#define LED_COUNT            5
+#define LED_POWER_LIMIT    150 //mA, the strip dims frames that would draw more
+
 #define BUTTON_COUNT         4
 #define BUTTON_DELAY        50
 
@@ -41,8 +46,9 @@
 #define TEAM_COUNT     4
 #define START_TEAM     1
 #define LIGHT_UP_LASERPOINTER 1
-#define LIGHT_UP_LED 1
+#define LIGHT_UP_LED 100
 #define LIGHT_UP_LED_HIT 500
+#define LIGHT_FADE_TEAM 250
 
 #define ACTION_MARKER_CHANGE_WAIT_TIME 2000
 #define ACTION_TEAM_CHANGE_WAIT_TIME 2000
@@ -64,8 +70,25 @@
 IRrecv receiver(PIN_IR_RECEIVER);
 IRsend transmitter;
 IRdecodeBase decoder;
-U8GLIB_SH1106_128X64 u8g(U8G_I2C_OPT_NONE);  
-Adafruit_WS2801 strip = Adafruit_WS2801(5, PIN_WS2801_DATA, PIN_WS2801_CLOCK);
+//the fastest I2C speed (up to 1MHz) the display acknowledges is selected at startup
+U8GLIB_SH1106_128X64 u8g(U8G_I2C_OPT_PROBE);
+//the display body is recorded once per refresh and replayed for every page
+u8g_dl_t displayList;
+uint8_t displayListBuffer[160];
+//glyph index for each font used on the display, every 16th glyph of the font
+u8g_font_index_t fontIndex[3];
+uint16_t fontIndexBuffer[3][16];
+//measured string widths, for the right aligned marker name
+u8g_sc_t stringCache;
+u8g_sc_entry_t stringCacheEntries[2];
+//pages are sent by the TWI interrupt while the next page is rendered
+//(only if U8G_WITH_I2C_QUEUE is enabled in u8g.h), one SH1106 page needs 150 bytes
+#ifdef U8G_WITH_I2C_QUEUE
+uint8_t i2cQueueBuffer[150];
+#endif
+typedef WS2801Strip<LED_COUNT, WS2801_RGB, PIN_WS2801_DATA, PIN_WS2801_CLOCK> LightStrip;
+LightStrip strip;
+WS2801Effects<LightStrip> lights(strip);
 
 
 struct Buttons {
@@ -158,7 +181,16 @@ void setup() {
 	receiver.enableIRIn();
 	Serial.begin(9600);
 	strip.begin();
+	strip.setPowerLimit(LED_POWER_LIMIT);
 	strip.show();
+	u8g.setDisplayList(&displayList, displayListBuffer, sizeof(displayListBuffer));
+	u8g.addFontIndex(&fontIndex[0], u8g_font_6x10, fontIndexBuffer[0], 16);
+	u8g.addFontIndex(&fontIndex[1], u8g_font_5x7, fontIndexBuffer[1], 16);
+	u8g.addFontIndex(&fontIndex[2], u8g_font_9x15, fontIndexBuffer[2], 16);
+	u8g.setStrCache(&stringCache, stringCacheEntries, 2);
+#ifdef U8G_WITH_I2C_QUEUE
+	u8g.setI2CQueue(i2cQueueBuffer, sizeof(i2cQueueBuffer));
+#endif
 	setupButtons();
 	start();
 }
@@ -208,13 +240,6 @@ void evaluateButtons() {
 	}
 }
 
-void setLEDColor(uint32_t c) {
-	for (unsigned int i = 0; i < strip.numPixels(); i++) {
-		strip.setPixelColor(i, c);
-	}
-	strip.show();
-}
-
 void start() {
 	setTeam(START_TEAM);
 	setMarker(START_MARKER);
@@ -236,7 +261,7 @@ void refreshDisplayValues() {
 			u8g.drawStr(6, 25, F("Charges"));
 			u8g.drawStr(78, 25, F("Energy"));
 			
-			u8g.setPrintPos((128 - ((temp.length() * 6) + 1)), 10);
+			u8g.setPrintPos(128 - u8g.getStrWidth(temp.c_str()), 10);
 			u8g.print(temp);
 			u8g.drawStr(34, 62, F("Hit by "));
 			u8g.setPrintPos(69, 62);
@@ -291,7 +316,7 @@ void loop() {
 		
 		
 			if (hitByCode != teams[currentTeam].code) {
-				setLEDColor(hitByColor);
+				lights.flash(hitByColor, LIGHT_UP_LED_HIT);
 				currentEnergy = currentEnergy + getMarkerDamageByCode(getMarkerCodeFromHit(lastHit));
 				lastHit = 0;
 				msSinceLastHit = millis();
@@ -339,12 +364,8 @@ void loop() {
 }
 
 void refreshLights() {
-	if (millis() > (msSinceLastHit + LIGHT_UP_LED_HIT)) {
-		setLEDColor(teams[currentTeam].color);
-		if (millis() > (msSinceLastShot + LIGHT_UP_LED)) {
-			setLEDColor(teams[currentTeam].color);
-		}
-	}
+	//only writes to the strip when the effect frame actually changed
+	lights.update();
 	if (millis() > (msSinceLastShot + LIGHT_UP_LASERPOINTER)) {
 		digitalWrite(PIN_LASER_POINTER, LOW);
 	}
@@ -375,7 +396,7 @@ void shot(long teamCode, int markerCode) {
 		
 		updateDisplay = true;
 		digitalWrite(PIN_LASER_POINTER, HIGH);
-		setLEDColor(WHITE);
+		lights.flash(WHITE, LIGHT_UP_LED);
 	}
 }
 
@@ -415,7 +436,7 @@ void respawn() {
 
 void setTeam(int team) {
 	currentTeam = team;
-	setLEDColor(teams[team].color);
+	lights.fade(teams[team].color, LIGHT_FADE_TEAM);
 }
 
 void setMarker(int marker) {
@@ -38,9 +38,40 @@ static void spi_out(uint8_t n) {
 
 // All other boards support Full and Proper Hardware SPI
 
-#include <SPI.h>
+#ifndef WS2801_HOST
+ #include <SPI.h> // (host build gets its SPI stand-in from WS2801Capture.h)
+#endif
 #define spi_out(n) (void)SPI.transfer(n)
 
+#if defined(WS2801_ASYNC) && defined(__AVR__) && defined(SPDR)
+
+// AVR hardware SPI can also be fed from the transfer-complete interrupt:
+// show() hands a copy of the frame to the ISR below and returns, rather
+// than spinning on SPIF for ~8us per byte at SPI_CLOCK_DIV16.  There's
+// only one SPI peripheral, so this state is shared by all instances.
+// Opt-in (see WS2801_ASYNC in Adafruit_WS2801.h), as the ISR claims the
+// SPI interrupt for the whole sketch.
+
+#define WS2801_ASYNC_SPI
+
+static const uint8_t * volatile asyncPtr;     // Next byte to send
+static volatile uint16_t        asyncLeft;    // Bytes left after that one
+static volatile boolean         asyncBusy;    // Frame still shifting out
+static volatile uint32_t        asyncDoneTime; // micros() of last byte
+
+ISR(SPI_STC_vect) {
+  if(asyncLeft) {
+    asyncLeft--;
+    SPDR = *asyncPtr++;
+  } else {
+    SPCR         &= ~_BV(SPIE); // Done; SPI.transfer() can poll SPIF again
+    asyncDoneTime = micros();   // Latch period starts now
+    asyncBusy     = false;
+  }
+}
+
+#endif
+
 #endif
 
 /*****************************************************************************/
@@ -69,12 +100,28 @@ Adafruit_WS2801::Adafruit_WS2801(uint16_t w, uint16_t h, uint8_t dpin, uint8_t c
   alloc(w * h);
   width  = w;
   height = h;
+  // Precompute where each row starts so x,y lookups need no multiply or
+  // modulo: even rows run left to right from y*w, odd rows right to left
+  // from y*w+w-1.  Costs 2 bytes per row; without it (or if allocation
+  // fails) x,y access falls back to computing the offset every call.
+  if((numLEDs == w * h) &&
+     ((rowofs = (uint16_t *)malloc(h * sizeof(uint16_t))) != NULL)) {
+    for(uint16_t y=0, ofs=0; y<h; y++, ofs += w) {
+      rowofs[y] = (y & 1) ? (ofs + w - 1) : ofs;
+    }
+  }
   updatePins(dpin, cpin);
 }
 
 // Allocate 3 bytes per pixel, init to RGB 'off' state:
 void Adafruit_WS2801::alloc(uint16_t n) {
   begun   = false;
+  dirty   = true;
+  txbuf   = NULL;
+  rowofs  = NULL;
+  width   = height = 0;
+  brightness = 255;
+  powerLimit = milliamps = 0;
   numLEDs = ((pixels = (uint8_t *)calloc(n, 3)) != NULL) ? n : 0;
 }
 
@@ -86,15 +133,24 @@ void Adafruit_WS2801::alloc(uint16_t n) {
 // Also, updateOrder() to change RGB vs GRB order (RGB is default).
 Adafruit_WS2801::Adafruit_WS2801(void) {
   begun     = false;
+  dirty     = true;
   numLEDs   = 0;
   pixels    = NULL;
+  txbuf     = NULL;
+  rowofs    = NULL;
+  width     = height = 0;
+  brightness = 255;
+  powerLimit = milliamps = 0;
   rgb_order = WS2801_RGB;
   updatePins(); // Must assume hardware SPI until pins are set
 }
 
 // Release memory (as needed):
 Adafruit_WS2801::~Adafruit_WS2801(void) {
+  waitAsync(); // Don't free a buffer the SPI interrupt is still reading
   if(pixels) free(pixels);
+  if(txbuf)  free(txbuf);
+  if(rowofs) free(rowofs);
 }
 
 // Activate hard/soft SPI as appropriate:
@@ -114,6 +170,7 @@ void Adafruit_WS2801::updatePins(void) {
   pinMode(clkpin , INPUT);
   datapin     = clkpin = 0;
   hardwareSPI = true;
+  dirty       = true; // Strand on the new pins has not seen our data yet
   // If begin() was previously invoked, init the SPI hardware now:
   if(begun == true) startSPI();
   // Otherwise, SPI is NOT initted until begin() is explicitly called.
@@ -124,6 +181,7 @@ void Adafruit_WS2801::updatePins(uint8_t dpin, uint8_t cpin) {
   if(begun == true) { // If begin() was previously invoked...
     // If previously using hardware SPI, turn that off:
     if(hardwareSPI) {
+      waitAsync();
 #ifdef __AVR_ATtiny85__
       DDRB &= ~(_BV(PORTB1) | _BV(PORTB2));
 #else
@@ -146,6 +204,7 @@ void Adafruit_WS2801::updatePins(uint8_t dpin, uint8_t cpin) {
   datapinmask = digitalPinToBitMask(dpin);
 #endif
   hardwareSPI = false;
+  dirty       = true; // Strand on the new pins has not seen our data yet
 }
 
 // Enable SPI hardware and set up protocol details:
@@ -171,37 +230,133 @@ uint16_t Adafruit_WS2801::numPixels(void) {
 
 // Change strand length (see notes with empty constructor, above):
 void Adafruit_WS2801::updateLength(uint16_t n) {
+  boolean async = (txbuf != NULL);
+  waitAsync();
   if(pixels != NULL) free(pixels); // Free existing data (if any)
+  if(txbuf  != NULL) free(txbuf);
+  txbuf   = NULL;
   // Allocate new data -- note: ALL PIXELS ARE CLEARED
   numLEDs = ((pixels = (uint8_t *)calloc(n, 3)) != NULL) ? n : 0;
+  dirty   = true;
+  if(async) updateAsync(true); // Resize transmit buffer to match
   // 'begun' state does not change -- pins retain prior modes
 }
 
 // Change RGB data order (see notes with empty constructor, above):
 void Adafruit_WS2801::updateOrder(uint8_t order) {
   rgb_order = order;
+  dirty     = true;
   // Existing LED data, if any, is NOT reformatted to new data order.
   // Calling function should clear or fill pixel data anew.
 }
 
+// Switch show() between blocking and interrupt-driven output.  Async mode
+// allocates a second pixel buffer: show() copies the frame there, starts
+// the first byte and returns, and the SPI interrupt sends the rest while
+// the sketch draws the next frame into the regular buffer.  Only applies
+// to hardware SPI on AVR with WS2801_ASYNC defined; elsewhere show() just
+// stays blocking.  Nothing else may use the SPI bus while busy() is true.
+void Adafruit_WS2801::updateAsync(boolean async) {
+  waitAsync();
+  if(txbuf != NULL) {
+    free(txbuf);
+    txbuf = NULL;
+  }
+#ifdef WS2801_ASYNC_SPI
+  // If allocation fails, txbuf stays NULL and show() remains blocking
+  if(async && numLEDs) txbuf = (uint8_t *)malloc(numLEDs * 3);
+#else
+  (void)async;
+#endif
+}
+
+boolean Adafruit_WS2801::busy(void) {
+#ifdef WS2801_ASYNC_SPI
+  if(txbuf == NULL) return false;
+  // The ISR writes both; a 32-bit read could tear, so snapshot them
+  // with interrupts off:
+  uint8_t  sreg = SREG;
+  cli();
+  boolean  b    = asyncBusy;
+  uint32_t t    = asyncDoneTime;
+  SREG = sreg;
+  // Frame still shifting out, or clock not yet held low long enough to latch
+  return b || ((uint32_t)(micros() - t) < 1000L);
+#else
+  return false;
+#endif
+}
+
+// Block until any async frame has been sent and latched:
+void Adafruit_WS2801::waitAsync(void) {
+#ifdef WS2801_ASYNC_SPI
+  while(busy());
+#endif
+}
+
+// Set global brightness.  Applied while clocking data out in show(), so
+// the pixel buffer keeps full precision and getPixelColor() is unaffected.
+void Adafruit_WS2801::setBrightness(uint8_t b) {
+  if(b != brightness) dirty = true;
+  brightness = b;
+}
+
+// Limit estimated current draw (see WS2801_MA_PER_CHANNEL); show() dims
+// any frame that would exceed it, on top of setBrightness().
+void Adafruit_WS2801::setPowerLimit(uint16_t mA) {
+  if(mA != powerLimit) dirty = true;
+  powerLimit = mA;
+}
+
+uint16_t Adafruit_WS2801::current(void) {
+  return milliamps;
+}
+
 void Adafruit_WS2801::show(void) {
-  uint16_t i, nl3 = numLEDs * 3; // 3 bytes per LED
-  uint8_t  bit;
+  uint16_t i, nl3 = numLEDs * 3, w; // 3 bytes per LED
+  uint32_t sum = 0;
+  uint8_t  bit, v;
+
+  // The WS2801 chips hold their last color, so if no pixel changed since
+  // the previous show() there's nothing to clock out and no latch to wait
+  // for.  The whole strand is always resent otherwise; the chips are a
+  // shift register chain and can't be addressed individually.
+  if(!dirty) return;
+  dirty = false;
+
+  // Brightness and power limit become one 8-bit scale for the frame:
+  for(i=0; i<nl3; i++) sum += pixels[i];
+  w = ws2801_showScale(sum, brightness, powerLimit, &milliamps);
+
+#ifdef WS2801_ASYNC_SPI
+  if(hardwareSPI && (txbuf != NULL) && nl3) {
+    // Previous frame must be fully latched before its buffer is reused
+    while(busy());
+    for(i=0; i<nl3; i++) txbuf[i] = ws2801_scale8(pixels[i], w);
+    asyncPtr  = &txbuf[1];
+    asyncLeft = nl3 - 1;
+    asyncBusy = true;
+    SPCR     |= _BV(SPIE);
+    SPDR      = txbuf[0]; // ISR takes it from here
+    return;               // busy() covers the latch delay
+  }
+#endif
 
   // Write 24 bits per pixel:
   if(hardwareSPI) {
-    for(i=0; i<nl3; i++) spi_out(pixels[i]);
+    for(i=0; i<nl3; i++) spi_out(ws2801_scale8(pixels[i], w));
   } else {
     for(i=0; i<nl3; i++ ) {
+      v = ws2801_scale8(pixels[i], w);
       for(bit=0x80; bit; bit >>= 1) {
 #ifdef __AVR__
-        if(pixels[i] & bit) *dataport |=  datapinmask;
-        else                *dataport &= ~datapinmask;
+        if(v & bit) *dataport |=  datapinmask;
+        else        *dataport &= ~datapinmask;
         *clkport |=  clkpinmask;
         *clkport &= ~clkpinmask;
 #else
-        if(pixels[i] & bit) digitalWrite(datapin, HIGH);
-        else                digitalWrite(datapin, LOW);
+        if(v & bit) digitalWrite(datapin, HIGH);
+        else        digitalWrite(datapin, LOW);
         digitalWrite(clkpin, HIGH);
         digitalWrite(clkpin, LOW);
 #endif
@@ -215,62 +370,137 @@ void Adafruit_WS2801::show(void) {
 // Set pixel color from separate 8-bit R, G, B components:
 void Adafruit_WS2801::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
   if(n < numLEDs) { // Arrays are 0-indexed, thus NOT '<='
-    uint8_t *p = &pixels[n * 3];
+    uint8_t *p = &pixels[n * 3], c0, c1;
     // See notes later regarding color order
     if(rgb_order == WS2801_RGB) {
-      *p++ = r;
-      *p++ = g;
+      c0 = r;
+      c1 = g;
     } else {
-      *p++ = g;
-      *p++ = r;
+      c0 = g;
+      c1 = r;
+    }
+    // Only flag the strand for show() if the stored color actually changes
+    if((p[0] != c0) || (p[1] != c1) || (p[2] != b)) {
+      p[0]  = c0;
+      p[1]  = c1;
+      p[2]  = b;
+      dirty = true;
     }
-    *p++ = b;
   }
 }
 
 // Set pixel color from separate 8-bit R, G, B components using x,y coordinate system:
 void Adafruit_WS2801::setPixelColor(uint16_t x, uint16_t y, uint8_t r, uint8_t g, uint8_t b) {
+  setPixelColor(matrixIndex(x, y), r, g, b);
+}
+
+// Map x,y coordinate to strand position (numLEDs if it's off the matrix):
+uint16_t Adafruit_WS2801::matrixIndex(uint16_t x, uint16_t y) {
+  if(width == 0) return numLEDs;
+  if(x >= width) x %= width; // Rare; keeps the wrap-around of x
+  if(rowofs != NULL) {
+    if(y >= height) return numLEDs;
+    return (y & 1) ? (rowofs[y] - x) : (rowofs[y] + x);
+  }
   boolean evenRow = ((y % 2) == 0);
   // calculate x offset first
-  uint16_t offset = x % width;
+  uint16_t offset = x;
   if (!evenRow) {
     offset = (width-1) - offset;
   }
   // add y offset
   offset += y * width;
-  setPixelColor(offset, r, g, b);
+  return offset;
+}
+
+// Set a whole matrix row from 'width' packed 32-bit RGB values, left to
+// right.  The row position is looked up once, then the pixel pointer just
+// steps forwards (even rows) or backwards (odd rows) along the strand.
+void Adafruit_WS2801::setRow(uint16_t y, const uint32_t *c) {
+  if((rowofs == NULL) || (y >= height)) return;
+  // updateLength() may have shrunk (or failed to allocate) the strand
+  // since the matrix was set up; the whole row must still be on it
+  if((uint32_t)(y + 1) * width > numLEDs) return;
+
+  uint8_t *p    = &pixels[rowofs[y] * 3], c0, c1, c2;
+  int8_t   step = (y & 1) ? -3 : 3;
+  for(uint16_t x=0; x<width; x++, p += step) {
+    uint32_t v = c[x];
+    if(rgb_order == WS2801_RGB) {
+      c0 = v >> 16; // Red
+      c1 = v >>  8; // Green
+    } else {
+      c0 = v >>  8; // Green
+      c1 = v >> 16; // Red
+    }
+    c2 = v;         // Blue
+    if((p[0] != c0) || (p[1] != c1) || (p[2] != c2)) {
+      p[0]  = c0;
+      p[1]  = c1;
+      p[2]  = c2;
+      dirty = true;
+    }
+  }
 }
 
 // Set pixel color from 'packed' 32-bit RGB value:
 void Adafruit_WS2801::setPixelColor(uint16_t n, uint32_t c) {
   if(n < numLEDs) { // Arrays are 0-indexed, thus NOT '<='
-    uint8_t *p = &pixels[n * 3];
+    uint8_t *p = &pixels[n * 3], c0, c1, c2 = c; // Blue
     // To keep the show() loop as simple & fast as possible, the
     // internal color representation is native to different pixel
     // types.  For compatibility with existing code, 'packed' RGB
     // values passed in or out are always 0xRRGGBB order.
     if(rgb_order == WS2801_RGB) {
-      *p++ = c >> 16; // Red
-      *p++ = c >>  8; // Green
+      c0 = c >> 16; // Red
+      c1 = c >>  8; // Green
     } else {
-      *p++ = c >>  8; // Green
-      *p++ = c >> 16; // Red
+      c0 = c >>  8; // Green
+      c1 = c >> 16; // Red
+    }
+    // Only flag the strand for show() if the stored color actually changes
+    if((p[0] != c0) || (p[1] != c1) || (p[2] != c2)) {
+      p[0]  = c0;
+      p[1]  = c1;
+      p[2]  = c2;
+      dirty = true;
     }
-    *p++ = c;         // Blue
   }
 }
 
 // Set pixel color from 'packed' 32-bit RGB value using x,y coordinate system:
 void Adafruit_WS2801::setPixelColor(uint16_t x, uint16_t y, uint32_t c) {
-  boolean evenRow = ((y % 2) == 0);
-  // calculate x offset first
-  uint16_t offset = x % width;
-  if (!evenRow) {
-    offset = (width-1) - offset;
+  setPixelColor(matrixIndex(x, y), c);
+}
+
+// Set 'count' pixels starting at 'first' to one packed 32-bit RGB value
+// (count of 0 fills through the end of the strand).  The color order
+// swizzle is done once for the whole run rather than once per pixel.
+void Adafruit_WS2801::fill(uint32_t c, uint16_t first, uint16_t count) {
+  if(first >= numLEDs) return;
+  if((count == 0) || (count > (numLEDs - first))) count = numLEDs - first;
+
+  uint8_t *p   = &pixels[first * 3],
+          *end = p + count * 3,
+           c0, c1, c2 = c; // Blue
+  if(rgb_order == WS2801_RGB) {
+    c0 = c >> 16; // Red
+    c1 = c >>  8; // Green
+  } else {
+    c0 = c >>  8; // Green
+    c1 = c >> 16; // Red
   }
-  // add y offset
-  offset += y * width;
-  setPixelColor(offset, c);
+
+  // Skip over the leading pixels that already have this color; if that's
+  // all of them, the strand stays clean and the next show() is free.
+  while((p < end) && (p[0] == c0) && (p[1] == c1) && (p[2] == c2)) p += 3;
+  if(p == end) return;
+  for(; p < end; p += 3) {
+    p[0] = c0;
+    p[1] = c1;
+    p[2] = c2;
+  }
+  dirty = true;
 }
 
 // Query color from previously-set pixel (returns packed 32-bit RGB value)
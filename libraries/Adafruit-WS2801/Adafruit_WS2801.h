@@ -1,7 +1,9 @@
 #ifndef __ADAFRUIT_WS2801__
 #define __ADAFRUIT_WS2801__
 
-#if (ARDUINO >= 100)
+#if defined(WS2801_HOST)
+ #include "WS2801Capture.h" // PC build: output goes to an in-memory capture
+#elif (ARDUINO >= 100)
  #include <Arduino.h>
 #else
  #include <WProgram.h>
@@ -16,6 +18,36 @@
 #define WS2801_RGB 0
 #define WS2801_GRB 1
 
+// Uncomment to let updateAsync(true) send frames from the SPI transfer
+// complete interrupt (AVR hardware SPI only).  The library then defines
+// ISR(SPI_STC_vect), so no other library in the sketch may use it.
+//#define WS2801_ASYNC
+
+// Rough current drawn by one color channel at full duty, used to estimate
+// the draw of a frame for setPowerLimit().  Adafruit's 12mm pixels take
+// about 60mA at full white.
+#ifndef WS2801_MA_PER_CHANNEL
+ #define WS2801_MA_PER_CHANNEL 20
+#endif
+
+// Scale 8-bit value by w/256, w = 0..256:
+static inline uint8_t ws2801_scale8(uint8_t v, uint16_t w) {
+  return ((uint16_t)v * w) >> 8;
+}
+
+// Work out the ws2801_scale8() weight show() applies to a frame whose
+// bytes add up to 'sum': global brightness, lowered further if the frame
+// would draw more than 'limit' mA (0 = no limit).  Stores the estimated
+// draw after scaling in 'mA'.  Only two divides per frame, none per pixel.
+static inline uint16_t ws2801_showScale(uint32_t sum, uint8_t brightness,
+  uint16_t limit, uint16_t *mA) {
+  uint32_t full = sum * WS2801_MA_PER_CHANNEL / 255; // Draw at full scale
+  uint16_t w    = brightness + 1;
+  if(limit && (((full * w) >> 8) > limit)) w = ((uint32_t)limit << 8) / full;
+  *mA = (full * w) >> 8;
+  return w;
+}
+
 class Adafruit_WS2801 {
 
  public:
@@ -37,12 +69,20 @@ class Adafruit_WS2801 {
     setPixelColor(uint16_t n, uint32_t c),
     setPixelColor(uint16_t x, uint16_t y, uint8_t r, uint8_t g, uint8_t b),
     setPixelColor(uint16_t x, uint16_t y, uint32_t c),
+    fill(uint32_t c, uint16_t first=0, uint16_t count=0), // Set a run of pixels
+    setRow(uint16_t y, const uint32_t *c), // Set 'width' pixels, matrix mode
+    setBrightness(uint8_t b), // Output scale applied by show(), 255 = full
+    setPowerLimit(uint16_t mA), // Cap estimated strand current, 0 = none
     updatePins(uint8_t dpin, uint8_t cpin), // Change pins, configurable
     updatePins(void), // Change pins, hardware SPI
     updateLength(uint16_t n), // Change strand length
-    updateOrder(uint8_t order); // Change data order
+    updateOrder(uint8_t order), // Change data order
+    updateAsync(boolean async); // Interrupt-driven show(), hardware SPI
   uint16_t
-    numPixels(void);
+    numPixels(void),
+    current(void); // Estimated mA drawn by the last frame shown
+  boolean
+    busy(void); // 'true' while an async show() is still on the wire
   uint32_t
     getPixelColor(uint16_t n);
 
@@ -51,11 +91,17 @@ class Adafruit_WS2801 {
   uint16_t
     numLEDs,
     width,     // used with matrix mode
-    height;    // used with matrix mode
+    height,    // used with matrix mode
+    *rowofs;   // matrix mode: strand index of x=0 for each row
+  uint16_t
+    powerLimit, // mA budget for show(), 0 if unlimited
+    milliamps;  // Estimated draw of the last frame shown
   uint8_t
     *pixels,   // Holds color values for each LED (3 bytes each)
+    *txbuf,    // Copy of 'pixels' being clocked out by async show()
     rgb_order, // Color order; RGB vs GRB (or others, if needed in future)
-    clkpin    , datapin;     // Clock & data pin numbers
+    clkpin    , datapin,     // Clock & data pin numbers
+    brightness;              // Global output scale, 255 = full
 #ifdef __AVR__
   uint8_t
     clkpinmask, datapinmask; // Clock & data PORT bitmasks
@@ -64,10 +110,14 @@ class Adafruit_WS2801 {
 #endif
   void
     alloc(uint16_t n),
-    startSPI(void);
+    startSPI(void),
+    waitAsync(void);
+  uint16_t
+    matrixIndex(uint16_t x, uint16_t y);
   boolean
     hardwareSPI, // If 'true', using hardware SPI
-    begun;       // If 'true', begin() method was previously invoked
+    begun,       // If 'true', begin() method was previously invoked
+    dirty;       // If 'true', pixel data changed since the last show()
 };
 
 #endif // __ADAFRUIT_WS2801__
@@ -0,0 +1,132 @@
+#include "Adafruit_WS2801_Multi.h"
+
+// Parallel output to several WS2801 strands sharing one clock line.
+// See notes in Adafruit_WS2801_Multi.h regarding the pixel data layout.
+/*****************************************************************************/
+
+Adafruit_WS2801_Multi::Adafruit_WS2801_Multi(uint16_t n, const uint8_t *dpins,
+  uint8_t nstrips, uint8_t cpin, uint8_t order) {
+  uint8_t s;
+
+  if(nstrips > WS2801_MULTI_MAX) nstrips = WS2801_MULTI_MAX;
+  rgb_order  = order;
+  strips     = nstrips;
+  clkpin     = cpin;
+  allpinmask = 0;
+  dirty      = true;
+  // 8 bit planes per byte, 3 bytes per pixel; init to RGB 'off' state:
+  numLEDs    = ((planes = (uint8_t *)calloc(n, 24)) != NULL) ? n : 0;
+
+#ifdef __AVR__
+  clkport    = portOutputRegister(digitalPinToPort(cpin));
+  clkpinmask = digitalPinToBitMask(cpin);
+  dataport   = portOutputRegister(digitalPinToPort(dpins[0]));
+#endif
+  for(s=0; s<strips; s++) {
+    datapin[s] = dpins[s];
+#ifdef __AVR__
+    // One PORT write per bit only works if every data pin is on it
+    datapinmask[s] = (portOutputRegister(digitalPinToPort(dpins[s])) ==
+      dataport) ? digitalPinToBitMask(dpins[s]) : 0;
+#else
+    datapinmask[s] = 1 << s;
+#endif
+    allpinmask |= datapinmask[s];
+  }
+}
+
+// Release memory (as needed):
+Adafruit_WS2801_Multi::~Adafruit_WS2801_Multi(void) {
+  if(planes) free(planes);
+}
+
+void Adafruit_WS2801_Multi::begin(void) {
+  for(uint8_t s=0; s<strips; s++) pinMode(datapin[s], OUTPUT);
+  pinMode(clkpin, OUTPUT);
+}
+
+uint16_t Adafruit_WS2801_Multi::numPixels(void) {
+  return numLEDs;
+}
+
+uint8_t Adafruit_WS2801_Multi::numStrips(void) {
+  return strips;
+}
+
+void Adafruit_WS2801_Multi::show(void) {
+  uint8_t *p   = planes,
+          *end = planes + numLEDs * 24; // 24 bit planes per LED
+
+  if(!dirty) return; // Same as Adafruit_WS2801: nothing changed, no resend
+  dirty = false;
+
+  // Each plane byte already carries the current bit of every strand:
+  while(p < end) {
+#ifdef __AVR__
+    *dataport = (*dataport & ~allpinmask) | *p++;
+    *clkport |=  clkpinmask;
+    *clkport &= ~clkpinmask;
+#else
+    uint8_t v = *p++;
+    for(uint8_t s=0; s<strips; s++)
+      digitalWrite(datapin[s], (v & datapinmask[s]) ? HIGH : LOW);
+    digitalWrite(clkpin, HIGH);
+    digitalWrite(clkpin, LOW);
+#endif
+  }
+
+  delay(1); // Data is latched by holding clock pin low for 1 millisecond
+}
+
+// Scatter the 8 bits of byte 'i' of strand 's' across its 8 bit planes:
+void Adafruit_WS2801_Multi::setByte(uint8_t s, uint16_t i, uint8_t v) {
+  uint8_t *p = &planes[i * 8], m = datapinmask[s], bit, old;
+
+  for(bit=0x80; bit; bit >>= 1, p++) {
+    old = *p;
+    *p  = (v & bit) ? (old | m) : (old & ~m);
+    if(*p != old) dirty = true;
+  }
+}
+
+// Gather byte 'i' of strand 's' back from its 8 bit planes:
+uint8_t Adafruit_WS2801_Multi::getByte(uint8_t s, uint16_t i) {
+  uint8_t *p = &planes[i * 8], m = datapinmask[s], bit, v = 0;
+
+  for(bit=0x80; bit; bit >>= 1, p++) if(*p & m) v |= bit;
+  return v;
+}
+
+// Set pixel color of strand 's' from separate 8-bit R, G, B components:
+void Adafruit_WS2801_Multi::setPixelColor(uint8_t s, uint16_t n,
+  uint8_t r, uint8_t g, uint8_t b) {
+  if((s < strips) && (n < numLEDs)) {
+    uint16_t ofs = n * 3;
+    if(rgb_order == WS2801_RGB) {
+      setByte(s, ofs    , r);
+      setByte(s, ofs + 1, g);
+    } else {
+      setByte(s, ofs    , g);
+      setByte(s, ofs + 1, r);
+    }
+    setByte(s, ofs + 2, b);
+  }
+}
+
+// Set pixel color of strand 's' from 'packed' 32-bit RGB value:
+void Adafruit_WS2801_Multi::setPixelColor(uint8_t s, uint16_t n, uint32_t c) {
+  setPixelColor(s, n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+}
+
+// Query color from previously-set pixel (returns packed 32-bit RGB value)
+uint32_t Adafruit_WS2801_Multi::getPixelColor(uint8_t s, uint16_t n) {
+  if((s < strips) && (n < numLEDs)) {
+    uint16_t ofs = n * 3;
+    uint8_t  c0  = getByte(s, ofs), c1 = getByte(s, ofs + 1);
+    return (rgb_order == WS2801_RGB) ?
+      ((uint32_t)c0 << 16) | ((uint16_t)c1 << 8) | getByte(s, ofs + 2) :
+      ((uint32_t)c1 << 16) | ((uint16_t)c0 << 8) | getByte(s, ofs + 2);
+  }
+
+  return 0; // Strand or pixel # is out of bounds
+}
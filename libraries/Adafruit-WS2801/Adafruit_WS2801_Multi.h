@@ -0,0 +1,64 @@
+#ifndef __ADAFRUIT_WS2801_MULTI__
+#define __ADAFRUIT_WS2801_MULTI__
+
+#include "Adafruit_WS2801.h"
+
+// Drives up to 8 equal-length WS2801 strands whose data pins are all on
+// the same PORT and which share one clock pin.  Pixel data is stored
+// bit-transposed: for every byte of the strand there are 8 'plane' bytes,
+// one per bit, each holding that bit for all strands at their PORT bit
+// positions.  show() then writes one PORT byte and one clock pulse per
+// bit time, so N strands take no longer to update than a single one.
+// Memory cost is 24 bytes per pixel regardless of the number of strands.
+#define WS2801_MULTI_MAX 8
+
+class Adafruit_WS2801_Multi {
+
+ public:
+
+  // 'dpins' lists one data pin per strand; all must share a PORT on AVR
+  // (strands whose pin is on a different PORT than dpins[0] stay dark):
+  Adafruit_WS2801_Multi(uint16_t n, const uint8_t *dpins, uint8_t nstrips,
+    uint8_t cpin, uint8_t order=WS2801_RGB);
+  // Release memory (as needed):
+  ~Adafruit_WS2801_Multi();
+
+  void
+    begin(void),
+    show(void),
+    setPixelColor(uint8_t s, uint16_t n, uint8_t r, uint8_t g, uint8_t b),
+    setPixelColor(uint8_t s, uint16_t n, uint32_t c);
+  uint16_t
+    numPixels(void);
+  uint8_t
+    numStrips(void);
+  uint32_t
+    getPixelColor(uint8_t s, uint16_t n);
+
+ private:
+
+  uint16_t
+    numLEDs;   // Pixels per strand
+  uint8_t
+    *planes,   // Bit-transposed color values (24 bytes per pixel)
+    rgb_order, // Color order; RGB vs GRB
+    strips,    // Number of strands
+    clkpin,
+    datapin[WS2801_MULTI_MAX],
+    datapinmask[WS2801_MULTI_MAX], // PORT bitmask (AVR) or 1<<strand
+    allpinmask;                    // OR of all datapinmask values
+#ifdef __AVR__
+  uint8_t
+    clkpinmask;              // Clock PORT bitmask
+  volatile uint8_t
+    *clkport  , *dataport;   // Clock & (shared) data PORT registers
+#endif
+  void
+    setByte(uint8_t s, uint16_t i, uint8_t v);
+  uint8_t
+    getByte(uint8_t s, uint16_t i);
+  boolean
+    dirty;     // If 'true', pixel data changed since the last show()
+};
+
+#endif // __ADAFRUIT_WS2801_MULTI__
@@ -0,0 +1,181 @@
+#ifdef WS2801_HOST
+
+#include "WS2801Capture.h"
+#include <algorithm>
+#include <vector>
+
+// In-memory wire capture for host builds; see WS2801Capture.h.
+/*****************************************************************************/
+
+struct Channel {
+  uint8_t
+    datapin, clkpin,
+    cur, bits;          // Byte being assembled, bits in it so far
+  std::vector<uint8_t>
+    data;               // Bytes of the frame in progress
+  uint64_t
+    firstNs, lastNs,    // First and latest bit of the frame in progress
+    prevEndNs;          // Last bit of the previous frame
+  boolean
+    active, hasPrev;
+};
+
+static uint64_t                 clockNs;  // Virtual time
+static uint8_t                  level[256];
+static std::vector<Channel>     channels;
+static std::vector<WS2801Frame> done;
+
+WS2801HostSPI SPI;
+
+static Channel *findChannel(uint8_t dpin, uint8_t cpin) {
+  for(size_t i=0; i<channels.size(); i++) {
+    if((channels[i].datapin == dpin) && (channels[i].clkpin == cpin))
+      return &channels[i];
+  }
+  Channel c;
+  c.datapin = dpin;
+  c.clkpin  = cpin;
+  c.cur     = c.bits = 0;
+  c.firstNs = c.lastNs = c.prevEndNs = 0;
+  c.active  = c.hasPrev = false;
+  channels.push_back(c);
+  return &channels.back();
+}
+
+static void closeFrame(Channel *c) {
+  WS2801Frame f;
+  f.datapin  = c->datapin;
+  f.clkpin   = c->clkpin;
+  f.bytes    = c->data.size();
+  f.start    = c->firstNs / 1000;
+  f.busTime  = (c->lastNs - c->firstNs) / 1000;
+  f.latchGap = c->hasPrev ? (c->firstNs - c->prevEndNs) / 1000 : 0;
+  f.data     = (uint8_t *)malloc(f.bytes ? f.bytes : 1);
+  if(f.bytes) memcpy(f.data, &c->data[0], f.bytes);
+  done.push_back(f);
+
+  c->prevEndNs = c->lastNs;
+  c->hasPrev   = true;
+  c->active    = false;
+  c->bits      = 0; // A partial trailing byte is dropped, as by the chips
+  c->data.clear();
+}
+
+static bool startsBefore(const WS2801Frame &a, const WS2801Frame &b) {
+  return a.start < b.start;
+}
+
+// Close every frame whose clock has now been low long enough to latch.
+// Channels close lazily, so put the list back in order of start time:
+static void settle(void) {
+  for(size_t i=0; i<channels.size(); i++) {
+    if(channels[i].active &&
+       ((clockNs - channels[i].lastNs) >= WS2801_LATCH_US * 1000ULL))
+      closeFrame(&channels[i]);
+  }
+  std::stable_sort(done.begin(), done.end(), startsBefore);
+}
+
+static void clockBit(Channel *c, uint8_t bit) {
+  if(c->active && ((clockNs - c->lastNs) >= WS2801_LATCH_US * 1000ULL))
+    closeFrame(c);
+  if(!c->active) {
+    c->active  = true;
+    c->firstNs = clockNs;
+  }
+  c->cur    = (c->cur << 1) | (bit ? 1 : 0);
+  c->lastNs = clockNs;
+  if(++c->bits == 8) {
+    c->data.push_back(c->cur);
+    c->bits = 0;
+  }
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  clockNs += WS2801_HOST_WRITE_NS;
+  if(value && !level[pin]) { // Rising edge: clocks every attached channel
+    for(size_t i=0; i<channels.size(); i++) {
+      if(channels[i].clkpin == pin)
+        clockBit(&channels[i], level[channels[i].datapin]);
+    }
+  }
+  level[pin] = value ? HIGH : LOW;
+}
+
+void delay(unsigned long ms) {
+  clockNs += ms * 1000000ULL;
+}
+
+unsigned long millis(void) {
+  return clockNs / 1000000ULL;
+}
+
+unsigned long micros(void) {
+  return clockNs / 1000ULL;
+}
+
+uint8_t WS2801HostSPI::transfer(uint8_t b) {
+  Channel *c = findChannel(WS2801_HOST_SPI, WS2801_HOST_SPI);
+  for(uint8_t bit=0x80; bit; bit >>= 1) {
+    clockNs += WS2801_HOST_SPI_NS / 8;
+    clockBit(c, b & bit);
+  }
+  return 0;
+}
+
+void WS2801Capture::reset(void) {
+  for(size_t i=0; i<done.size(); i++) free(done[i].data);
+  done.clear();
+  channels.clear();
+  memset(level, 0, sizeof(level));
+  clockNs = 0;
+}
+
+void WS2801Capture::attach(uint8_t dpin, uint8_t cpin) {
+  (void)findChannel(dpin, cpin);
+}
+
+void WS2801Capture::advance(uint32_t us) {
+  clockNs += us * 1000ULL;
+}
+
+uint32_t WS2801Capture::now(void) {
+  return clockNs / 1000ULL;
+}
+
+uint16_t WS2801Capture::frames(void) {
+  settle();
+  return done.size();
+}
+
+const WS2801Frame *WS2801Capture::frame(uint16_t i) {
+  settle();
+  return (i < done.size()) ? &done[i] : NULL;
+}
+
+boolean WS2801Capture::compare(uint16_t i, const uint8_t *expect, uint16_t len) {
+  const WS2801Frame *f = frame(i);
+  return (f != NULL) && (f->bytes == len) && !memcmp(f->data, expect, len);
+}
+
+void WS2801Capture::report(FILE *f) {
+  unsigned long bytes = 0, bus = 0;
+
+  settle();
+  for(size_t i=0; i<done.size(); i++) {
+    fprintf(f, "frame=%u clk=%u data=%u bytes=%u bus_us=%lu latch_us=%lu\n",
+      (unsigned)i, done[i].clkpin, done[i].datapin, done[i].bytes,
+      (unsigned long)done[i].busTime, (unsigned long)done[i].latchGap);
+    bytes += done[i].bytes;
+    bus   += done[i].busTime;
+  }
+  fprintf(f, "frames=%u bytes=%lu bus_us=%lu\n",
+    (unsigned)done.size(), bytes, bus);
+}
+
+#endif // WS2801_HOST
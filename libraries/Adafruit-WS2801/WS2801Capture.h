@@ -0,0 +1,103 @@
+#ifndef __WS2801_CAPTURE__
+#define __WS2801_CAPTURE__
+
+// Host (PC) build support for the WS2801 classes.  Compile the library
+// sources with -DWS2801_HOST and, instead of Arduino.h and SPI.h, they get
+// the stand-ins below: pin writes and SPI bytes are decoded into frames
+// on a virtual clock, so tests and benchmarks can check exactly what
+// show() would put on the wire and how long it would take.
+//
+// A frame is everything clocked out between two latches (clock held low
+// for WS2801_LATCH_US).  For each one the capture keeps the bytes, the
+// bus time from first to last bit, and the latch gap since the previous
+// frame on the same pins.  Hardware SPI output is captured on the pseudo
+// clock pin WS2801_HOST_SPI; bit-banged pins must be attach()ed first.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define HIGH   1
+#define LOW    0
+#define INPUT  0
+#define OUTPUT 1
+
+#ifndef F_CPU
+ #define F_CPU 16000000L // Virtual board runs at Uno speed
+#endif
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+// Virtual cost of one pin write and of one hardware SPI byte (1MHz), in
+// nanoseconds; override to model a different board or clock divider.
+#ifndef WS2801_HOST_WRITE_NS
+ #define WS2801_HOST_WRITE_NS  250
+#endif
+#ifndef WS2801_HOST_SPI_NS
+ #define WS2801_HOST_SPI_NS   8000
+#endif
+
+#define WS2801_LATCH_US  500  // Clock low this long latches the strand
+#define WS2801_HOST_SPI 0xFF  // Pseudo clock pin of the hardware SPI bus
+
+void          pinMode(uint8_t pin, uint8_t mode);
+void          digitalWrite(uint8_t pin, uint8_t value);
+void          delay(unsigned long ms);
+unsigned long millis(void);
+unsigned long micros(void);
+
+#define MSBFIRST        1
+#define SPI_MODE0       0
+#define SPI_CLOCK_DIV16 1
+
+class WS2801HostSPI {
+ public:
+  void    begin(void) { }
+  void    end(void) { }
+  void    setBitOrder(uint8_t) { }
+  void    setDataMode(uint8_t) { }
+  void    setClockDivider(uint8_t) { }
+  uint8_t transfer(uint8_t b);
+};
+
+extern WS2801HostSPI SPI;
+
+struct WS2801Frame {
+  uint8_t
+    datapin, clkpin;
+  uint16_t
+    bytes;    // Whole bytes clocked out
+  uint32_t
+    start,    // Virtual time of the first bit, us
+    busTime,  // First to last bit, us
+    latchGap; // Since the end of the previous frame on these pins, us
+              // (0 for the first)
+  uint8_t
+    *data;
+};
+
+class WS2801Capture {
+ public:
+  // Forget all frames and channels, restart the virtual clock at 0:
+  static void reset(void);
+  // Decode bits on 'dpin' whenever 'cpin' goes high:
+  static void attach(uint8_t dpin, uint8_t cpin);
+  // Let virtual time pass, e.g. the rest of a sketch's loop():
+  static void advance(uint32_t us);
+  static uint32_t now(void); // us
+
+  // Completed (latched) frames, in order, across all channels:
+  static uint16_t frames(void);
+  static const WS2801Frame *frame(uint16_t i);
+  // True if frame 'i' is exactly 'len' bytes matching 'expect':
+  static boolean compare(uint16_t i, const uint8_t *expect, uint16_t len);
+  // One line per frame plus totals, as key=value pairs:
+  static void report(FILE *f);
+};
+
+#endif // __WS2801_CAPTURE__
@@ -0,0 +1,180 @@
+#ifndef __WS2801_EFFECTS__
+#define __WS2801_EFFECTS__
+
+#include "Adafruit_WS2801.h"
+
+// Non-blocking LED effects (fade, pulse, chase, flash) for any strip class
+// with the Adafruit_WS2801 interface: Adafruit_WS2801 or WS2801Strip<>.
+// Call update() from loop(); it works out the frame for the time elapsed
+// since the effect started and only touches the strip and calls show()
+// when that frame differs from the one last shown.
+//
+// Every frame is described by at most two colors: one for the whole
+// strand and one for a single 'head' pixel (chase).  So the work per
+// update() is bounded: a couple of 32-bit divides and 8-bit fixed point
+// blends, plus one fill() and one setPixelColor() when the frame changed.
+//
+// tools/ws2801bench measures the cost per 1ms tick on the host capture.
+// With 25 bit-banged LEDs a frame is ~450us on the wire; a 1s pulse
+// changes the frame on ~42% of ticks (~190us per tick on average), a
+// solid color after the first frame costs nothing.
+
+extern const uint8_t PROGMEM ws2801_gamma8[256];
+
+#define WS2801_FX_SOLID 0
+#define WS2801_FX_FADE  1
+#define WS2801_FX_PULSE 2
+#define WS2801_FX_CHASE 3
+
+#define WS2801_FX_NO_HEAD 0xFFFF // No separately colored pixel in frame
+
+// Blend two packed RGB colors, w = 0 (all 'a') .. 256 (all 'b'):
+static inline uint32_t ws2801_blend(uint32_t a, uint32_t b, uint16_t w) {
+  uint16_t v = 256 - w;
+  return
+    ((uint32_t)(ws2801_scale8(a >> 16, v) + ws2801_scale8(b >> 16, w)) << 16) |
+    ((uint16_t)(ws2801_scale8(a >>  8, v) + ws2801_scale8(b >>  8, w)) <<  8) |
+               (ws2801_scale8(a      , v) + ws2801_scale8(b      , w));
+}
+
+// Map progress 0..255 through the gamma table to a 0..256 blend weight:
+static inline uint16_t ws2801_gammaw(uint8_t t) {
+  uint8_t g = pgm_read_byte(&ws2801_gamma8[t]);
+  return g + (g >> 7);
+}
+
+// Rough brightness, only used to pick the gamma direction of a blend:
+static inline uint16_t ws2801_luma(uint32_t c) {
+  return (uint8_t)(c >> 16) + (uint8_t)(c >> 8) + (uint8_t)c;
+}
+
+template<class Strip>
+class WS2801Effects {
+
+ public:
+
+  WS2801Effects(Strip &s) :
+    strip(s), mode(WS2801_FX_SOLID), color(0), color2(0), start(0),
+    duration(1), flashColor(0), flashStart(0), flashDuration(0),
+    frameColor(0), frameHead(0), framePos(WS2801_FX_NO_HEAD),
+    fadeUp(false), shown(false) { }
+
+  // Static color for the whole strand:
+  void solid(uint32_t c) {
+    mode  = WS2801_FX_SOLID;
+    color = c;
+  }
+
+  // Cross-fade from the color currently shown to 'c' over 'ms':
+  void fade(uint32_t c, uint16_t ms, uint32_t now = millis()) {
+    color2 = (mode == WS2801_FX_CHASE) ? color2 : frameColor;
+    begin(WS2801_FX_FADE, c, ms, now);
+    fadeUp = ws2801_luma(c) >= ws2801_luma(color2);
+  }
+
+  // Breathe between off and 'c', one full cycle every 'ms':
+  void pulse(uint32_t c, uint16_t ms, uint32_t now = millis()) {
+    begin(WS2801_FX_PULSE, c, ms, now);
+  }
+
+  // Single 'c' pixel running over a 'bg' strand, advancing every 'ms':
+  void chase(uint32_t c, uint32_t bg, uint16_t ms, uint32_t now = millis()) {
+    color2 = bg;
+    begin(WS2801_FX_CHASE, c, ms, now);
+  }
+
+  // Damage flash: jump to 'c' and decay back into the running effect over
+  // 'ms'.  Overlays whatever effect is active rather than replacing it.
+  void flash(uint32_t c, uint16_t ms, uint32_t now = millis()) {
+    flashColor    = c;
+    flashStart    = now;
+    flashDuration = ms ? ms : 1;
+  }
+
+  // Render the frame for 'now'; returns true if the strand was updated.
+  boolean update(uint32_t now = millis()) {
+    uint32_t elapsed = now - start, c = color, h = 0;
+    uint16_t pos = WS2801_FX_NO_HEAD;
+    uint8_t  t;
+
+    if(!strip.numPixels()) return false;
+
+    switch(mode) {
+     case WS2801_FX_FADE:
+      if(elapsed >= duration) {
+        mode = WS2801_FX_SOLID; // Arrived; nothing left to compute
+        break;
+      }
+      t = (elapsed << 8) / duration;
+      c = fadeUp ? ws2801_blend(color2, color, ws2801_gammaw(t)) :
+        ws2801_blend(color, color2, ws2801_gammaw(255 - t));
+      break;
+     case WS2801_FX_PULSE:
+      // Triangle wave 0..255..0 over one period:
+      elapsed = ((elapsed % duration) << 9) / duration;
+      t = (elapsed < 256) ? elapsed : (511 - elapsed);
+      c = ws2801_blend(0, color, ws2801_gammaw(t));
+      break;
+     case WS2801_FX_CHASE:
+      pos = (elapsed / duration) % strip.numPixels();
+      c   = color2;
+      h   = color;
+      break;
+    }
+
+    if(flashDuration) {
+      elapsed = now - flashStart;
+      if(elapsed >= flashDuration) {
+        flashDuration = 0;
+      } else {
+        uint16_t w = ws2801_gammaw(255 - (uint8_t)((elapsed << 8) / flashDuration));
+        c = ws2801_blend(c, flashColor, w);
+        h = ws2801_blend(h, flashColor, w);
+      }
+    }
+
+    // Skip the strand entirely if the frame is the one already shown:
+    if(shown && (c == frameColor) && (pos == framePos) &&
+      ((pos == WS2801_FX_NO_HEAD) || (h == frameHead))) return false;
+
+    strip.fill(c);
+    if(pos != WS2801_FX_NO_HEAD) strip.setPixelColor(pos, h);
+    strip.show();
+    frameColor = c;
+    frameHead  = h;
+    framePos   = pos;
+    shown      = true;
+    return true;
+  }
+
+ private:
+
+  void begin(uint8_t m, uint32_t c, uint16_t ms, uint32_t now) {
+    mode     = m;
+    color    = c;
+    start    = now;
+    duration = ms ? ms : 1; // Avoid divide by zero
+  }
+
+  Strip
+    &strip;
+  uint8_t
+    mode;
+  uint32_t
+    color,         // Effect color (fade target, pulse peak, chase head)
+    color2,        // Fade origin or chase background
+    start,         // millis() when the effect started
+    duration,      // Fade time, pulse period or chase step, in ms
+    flashColor,
+    flashStart,
+    flashDuration, // 0 if no flash is active
+    frameColor,    // Last frame shown: strand color,
+    frameHead;     // head pixel color
+  uint16_t
+    framePos;      // and head pixel position
+  boolean
+    fadeUp,        // Fade target brighter than origin (gamma direction)
+    shown;         // frame* valid
+};
+
+#endif // __WS2801_EFFECTS__
@@ -0,0 +1,184 @@
+#ifndef __WS2801_STRIP__
+#define __WS2801_STRIP__
+
+#include "Adafruit_WS2801.h" // WS2801_RGB, WS2801_GRB
+
+// Statically sized alternative to Adafruit_WS2801 for bit-banged strands
+// whose length, color order and pins are fixed at compile time, e.g.:
+//
+//   WS2801Strip<5, WS2801_RGB, 6, 7> strip;
+//
+// The pixel array is a member (no calloc, so no heap fragmentation next
+// to String), the color order swizzle is folded by the compiler, and on
+// ATmega168/328 boards the PORT address and bitmask of each pin are
+// compile-time constants, so every data/clock toggle is a single sbi/cbi.
+// Other AVRs look the PORT up once in begin(); non-AVR uses digitalWrite.
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || \
+    defined(__AVR_ATmega168__)  || defined(__AVR_ATmega168P__)
+
+// Uno/Nano/Pro Mini layout: D0-D7 on PORTD, D8-D13 on PORTB, A0-A5 on
+// PORTC.  Addresses are the data space addresses of those PORT registers.
+template<uint8_t Pin> struct WS2801Pin {
+  static_assert(Pin < 20, "WS2801Strip: no such pin on this board");
+  static constexpr uint8_t
+    addr = (Pin <  8) ? 0x2B : (Pin < 14) ? 0x25 : 0x28,
+    mask = 1 << ((Pin < 8) ? Pin : (Pin < 14) ? (Pin - 8) : (Pin - 14));
+  static inline void init(void) { }
+  static inline void high(void) { _SFR_MEM8(addr) |=  mask; }
+  static inline void low(void)  { _SFR_MEM8(addr) &= ~mask; }
+};
+
+#elif defined(__AVR__)
+
+template<uint8_t Pin> struct WS2801Pin {
+  static volatile uint8_t *port;
+  static uint8_t           mask;
+  static inline void init(void) {
+    port = portOutputRegister(digitalPinToPort(Pin));
+    mask = digitalPinToBitMask(Pin);
+  }
+  static inline void high(void) { *port |=  mask; }
+  static inline void low(void)  { *port &= ~mask; }
+};
+template<uint8_t Pin> volatile uint8_t *WS2801Pin<Pin>::port;
+template<uint8_t Pin> uint8_t           WS2801Pin<Pin>::mask;
+
+#else
+
+template<uint8_t Pin> struct WS2801Pin {
+  static inline void init(void) { }
+  static inline void high(void) { digitalWrite(Pin, HIGH); }
+  static inline void low(void)  { digitalWrite(Pin, LOW); }
+};
+
+#endif
+
+template<uint16_t N, uint8_t Order, uint8_t DataPin, uint8_t ClockPin>
+class WS2801Strip {
+
+ public:
+
+  WS2801Strip() :
+    brightness(255), powerLimit(0), milliamps(0), dirty(true) {
+    memset(pixels, 0, sizeof(pixels)); // Init to RGB 'off' state
+  }
+
+  void begin(void) {
+    WS2801Pin<DataPin>::init();
+    WS2801Pin<ClockPin>::init();
+    pinMode(DataPin , OUTPUT);
+    pinMode(ClockPin, OUTPUT);
+  }
+
+  void show(void) {
+    uint32_t sum = 0;
+    uint16_t i, w;
+
+    if(!dirty) return; // See Adafruit_WS2801::show()
+    dirty = false;
+
+    for(i=0; i<N * 3; i++) sum += pixels[i];
+    w = ws2801_showScale(sum, brightness, powerLimit, &milliamps);
+
+    // Write 24 bits per pixel:
+    for(i=0; i<N * 3; i++) {
+      uint8_t v = ws2801_scale8(pixels[i], w);
+      for(uint8_t bit=0x80; bit; bit >>= 1) {
+        if(v & bit) WS2801Pin<DataPin>::high();
+        else        WS2801Pin<DataPin>::low();
+        WS2801Pin<ClockPin>::high();
+        WS2801Pin<ClockPin>::low();
+      }
+    }
+
+    delay(1); // Data is latched by holding clock pin low for 1 millisecond
+  }
+
+  // Set pixel color from separate 8-bit R, G, B components:
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    if(n < N) {
+      uint8_t *p  = &pixels[n * 3],
+               c0 = (Order == WS2801_RGB) ? r : g,
+               c1 = (Order == WS2801_RGB) ? g : r;
+      // Only flag the strand for show() if the stored color actually changes
+      if((p[0] != c0) || (p[1] != c1) || (p[2] != b)) {
+        p[0]  = c0;
+        p[1]  = c1;
+        p[2]  = b;
+        dirty = true;
+      }
+    }
+  }
+
+  // Set pixel color from 'packed' 32-bit RGB value:
+  void setPixelColor(uint16_t n, uint32_t c) {
+    setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+  }
+
+  // Set 'count' pixels starting at 'first' to one packed 32-bit RGB value
+  // (count of 0 fills through the end); like Adafruit_WS2801::fill(), a
+  // run that already has this color leaves the strand clean.
+  void fill(uint32_t c, uint16_t first=0, uint16_t count=0) {
+    if(first >= N) return;
+    if((count == 0) || (count > (N - first))) count = N - first;
+
+    uint8_t *p   = &pixels[first * 3],
+            *end = p + count * 3,
+             c0  = (Order == WS2801_RGB) ? (c >> 16) : (c >> 8),
+             c1  = (Order == WS2801_RGB) ? (c >>  8) : (c >> 16),
+             c2  = c;
+    while((p < end) && (p[0] == c0) && (p[1] == c1) && (p[2] == c2)) p += 3;
+    if(p == end) return;
+    for(; p < end; p += 3) {
+      p[0] = c0;
+      p[1] = c1;
+      p[2] = c2;
+    }
+    dirty = true;
+  }
+
+  // Query color from previously-set pixel (returns packed 32-bit RGB value)
+  uint32_t getPixelColor(uint16_t n) {
+    if(n < N) {
+      uint8_t *p = &pixels[n * 3];
+      return (Order == WS2801_RGB) ?
+        ((uint32_t)p[0] << 16) | ((uint16_t)p[1] << 8) | p[2] :
+        ((uint32_t)p[1] << 16) | ((uint16_t)p[0] << 8) | p[2];
+    }
+
+    return 0; // Pixel # is out of bounds
+  }
+
+  uint16_t numPixels(void) {
+    return N;
+  }
+
+  // Brightness and power limit work as in Adafruit_WS2801:
+  void setBrightness(uint8_t b) {
+    if(b != brightness) dirty = true;
+    brightness = b;
+  }
+
+  void setPowerLimit(uint16_t mA) {
+    if(mA != powerLimit) dirty = true;
+    powerLimit = mA;
+  }
+
+  uint16_t current(void) {
+    return milliamps;
+  }
+
+ private:
+
+  uint8_t
+    pixels[N * 3], // Holds color values for each LED (3 bytes each)
+    brightness;    // Global output scale, 255 = full
+  uint16_t
+    powerLimit,    // mA budget for show(), 0 if unlimited
+    milliamps;     // Estimated draw of the last frame shown
+  boolean
+    dirty;         // If 'true', pixel data changed since the last show()
+};
+
+#endif // __WS2801_STRIP__
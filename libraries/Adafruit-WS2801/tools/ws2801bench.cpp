@@ -0,0 +1,283 @@
+// ws2801bench.cpp
+//
+// Host benchmark and golden test for the WS2801 effects engine.  Each
+// scenario scripts WS2801Effects the way the Lightduino sketch does and
+// ticks it once per virtual millisecond, with every output class (the
+// WS2801Strip template, Adafruit_WS2801 bit-banged and on hardware SPI)
+// writing into the WS2801Capture backend.
+//
+// Reported per scenario and strand:
+//   us        host time per tick for update() and show()
+//   ticks     number of 1ms ticks
+//   frames    frames latched on the wire
+//   bytes     bytes clocked out, all frames
+//   bus_us    virtual bus time, all frames (what show() blocks on target)
+//   bus_tick  bus_us / ticks, the average per-tick cost on target
+//   crc       FNV-1a over the bytes of every frame
+//
+// Everything but 'us' is exact and host independent: a change in the
+// frames or bytes put on the wire shows up as a changed count or crc.
+// 'us' includes the capture stand-ins for digitalWrite and SPI, so use it
+// to compare versions on one host, not as a measure of AVR time.
+//
+// Usage:
+//   ws2801bench [-n <ticks>] [-c <reference.csv>] [-t <percent>] [<name> ...]
+//
+//   -n  ticks per scenario (default 2000)
+//   -c  compare with a previous result: changed counts and scenarios more
+//       than <percent> (default 10) slower are reported to stderr, and
+//       the exit code is 1
+//   A <name> selects scenarios ("pulse") or strands ("spi") or one run
+//   ("spi/pulse"); without names, everything is run.
+//
+// ws2801bench.csv is the result for the current library.  After a change,
+// 'ws2801bench -c ws2801bench.csv' must not report changed output unless
+// the frames on the wire are meant to change; regenerate it then.  Its
+// 'us' column is from one PC, so raise -t when comparing on another host.
+//
+// Build, from this directory:
+//   c++ -O2 -DWS2801_HOST -I.. -o ws2801bench ws2801bench.cpp
+//     ../Adafruit_WS2801.cpp ../WS2801Capture.cpp ../WS2801Effects.cpp
+
+#include "Adafruit_WS2801.h"
+#include "WS2801Strip.h"
+#include "WS2801Effects.h"
+#include "WS2801Capture.h"
+#include <time.h>
+
+#define BENCH_LEDS  25
+#define BENCH_DATA   6
+#define BENCH_CLOCK  7
+
+#define RED   0xFF0000
+#define BLUE  0x0000FF
+#define WHITE 0xFFFFFF
+
+// Scenarios
+/*****************************************************************************/
+
+// Called once per tick before update(); 't' is the tick (ms since start):
+template<class Fx> static void scriptSolid(Fx &fx, uint32_t t, uint32_t now) {
+  (void)now;
+  if(t == 0) fx.solid(RED);
+}
+
+template<class Fx> static void scriptFade(Fx &fx, uint32_t t, uint32_t now) {
+  if(t == 0)    fx.solid(RED);
+  if(t == 100)  fx.fade(BLUE, 500, now);
+  if(t == 1000) fx.fade(RED, 500, now);
+}
+
+template<class Fx> static void scriptPulse(Fx &fx, uint32_t t, uint32_t now) {
+  if(t == 0) fx.pulse(BLUE, 1000, now);
+}
+
+template<class Fx> static void scriptChase(Fx &fx, uint32_t t, uint32_t now) {
+  if(t == 0) fx.chase(WHITE, BLUE, 100, now);
+}
+
+// Team color with a shot every 250ms and a hit flash every second:
+template<class Fx> static void scriptHit(Fx &fx, uint32_t t, uint32_t now) {
+  if(t == 0)          fx.solid(BLUE);
+  if(t % 250 == 10)   fx.flash(WHITE, 100, now);
+  if(t % 1000 == 500) fx.flash(RED, 500, now);
+}
+
+enum { SOLID, FADE, PULSE, CHASE, HIT, SCENARIOS };
+
+static const char *scenarioName[SCENARIOS] = {
+  "solid", "fade", "pulse", "chase", "hit" };
+
+template<class Fx> static void script(uint8_t s, Fx &fx, uint32_t t,
+  uint32_t now) {
+  switch(s) {
+   case SOLID: scriptSolid(fx, t, now); break;
+   case FADE:  scriptFade(fx, t, now);  break;
+   case PULSE: scriptPulse(fx, t, now); break;
+   case CHASE: scriptChase(fx, t, now); break;
+   case HIT:   scriptHit(fx, t, now);   break;
+  }
+}
+
+// Measurement and reference data
+/*****************************************************************************/
+
+struct Result {
+  char          name[32];
+  double        us;
+  unsigned long ticks, frames, bytes, bus;
+  uint32_t      crc;
+};
+
+static Result ref[64];
+static int    refCount;
+
+static double hostMicros(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+template<class S> static void run(S &strip, uint8_t s, uint32_t ticks,
+  Result *r) {
+  WS2801Effects<S> fx(strip);
+  double           host = 0, t0;
+
+  for(uint32_t t=0; t<ticks; t++) {
+    uint32_t now = millis();
+    t0    = hostMicros();
+    script(s, fx, t, now);
+    fx.update(now);
+    host += hostMicros() - t0;
+    WS2801Capture::advance(1000); // Rest of the sketch's loop()
+  }
+  WS2801Capture::advance(WS2801_LATCH_US); // Latch the last frame
+
+  r->us     = host / ticks;
+  r->ticks  = ticks;
+  r->frames = WS2801Capture::frames();
+  r->bytes  = r->bus = 0;
+  r->crc    = 2166136261UL;
+  for(uint16_t i=0; i<r->frames; i++) {
+    const WS2801Frame *f = WS2801Capture::frame(i);
+    r->bytes += f->bytes;
+    r->bus   += f->busTime;
+    for(uint16_t j=0; j<f->bytes; j++)
+      r->crc = (r->crc ^ f->data[j]) * 16777619UL;
+  }
+}
+
+static void runStrip(uint8_t s, uint32_t ticks, Result *r) {
+  WS2801Strip<BENCH_LEDS, WS2801_RGB, BENCH_DATA, BENCH_CLOCK> strip;
+  WS2801Capture::reset();
+  WS2801Capture::attach(BENCH_DATA, BENCH_CLOCK);
+  strip.begin();
+  run(strip, s, ticks, r);
+}
+
+static void runPins(uint8_t s, uint32_t ticks, Result *r) {
+  Adafruit_WS2801 strip((uint16_t)BENCH_LEDS, (uint8_t)BENCH_DATA,
+    (uint8_t)BENCH_CLOCK, (uint8_t)WS2801_RGB);
+  WS2801Capture::reset();
+  WS2801Capture::attach(BENCH_DATA, BENCH_CLOCK);
+  strip.begin();
+  run(strip, s, ticks, r);
+}
+
+static void runSPI(uint8_t s, uint32_t ticks, Result *r) {
+  Adafruit_WS2801 strip(BENCH_LEDS, WS2801_RGB);
+  WS2801Capture::reset();
+  strip.begin();
+  run(strip, s, ticks, r);
+}
+
+static const struct {
+  const char *name;
+  void      (*run)(uint8_t s, uint32_t ticks, Result *r);
+} strands[] = {
+  { "strip", runStrip },
+  { "pins",  runPins  },
+  { "spi",   runSPI   }
+};
+
+static boolean readRef(const char *name) {
+  char  line[256];
+  FILE *fp = fopen(name, "r");
+  if(fp == NULL) {
+    perror(name);
+    return false;
+  }
+  while((refCount < 64) && (fgets(line, sizeof(line), fp) != NULL)) {
+    Result *r = &ref[refCount];
+    double  perTick;
+    if((line[0] == '#') || !strncmp(line, "name,", 5)) continue;
+    if(sscanf(line, "%31[^,],%lf,%lu,%lu,%lu,%lu,%lf,%x", r->name, &r->us,
+      &r->ticks, &r->frames, &r->bytes, &r->bus, &perTick, &r->crc) == 8)
+      refCount++;
+  }
+  fclose(fp);
+  return true;
+}
+
+// Returns true if the output changed or the run is slower than 'percent':
+static boolean compare(const Result *r, double percent) {
+  for(int i=0; i<refCount; i++) {
+    if(strcmp(ref[i].name, r->name)) continue;
+    if(ref[i].ticks != r->ticks) {
+      fprintf(stderr, "%s: %lu ticks in reference, not compared\n",
+        r->name, ref[i].ticks);
+      return false;
+    }
+    boolean changed = (ref[i].frames != r->frames) ||
+      (ref[i].bytes != r->bytes) || (ref[i].bus != r->bus) ||
+      (ref[i].crc != r->crc);
+    if(changed)
+      fprintf(stderr, "%s: output changed: frames %lu -> %lu, bytes %lu -> "
+        "%lu, bus_us %lu -> %lu, crc %08x -> %08x\n", r->name,
+        ref[i].frames, r->frames, ref[i].bytes, r->bytes, ref[i].bus, r->bus,
+        (unsigned)ref[i].crc, (unsigned)r->crc);
+    if(r->us > ref[i].us * (1.0 + percent / 100.0)) {
+      fprintf(stderr, "%s: slower: %.3f us -> %.3f us per tick\n",
+        r->name, ref[i].us, r->us);
+      changed = true;
+    }
+    return changed;
+  }
+  fprintf(stderr, "%s: not in reference\n", r->name);
+  return false;
+}
+
+static boolean selected(int argc, char **argv, int first, const char *strand,
+  const char *scenario, const char *name) {
+  if(first >= argc) return true;
+  for(int i=first; i<argc; i++) {
+    if(!strcmp(argv[i], strand) || !strcmp(argv[i], scenario) ||
+       !strcmp(argv[i], name)) return true;
+  }
+  return false;
+}
+
+int main(int argc, char **argv) {
+  uint32_t ticks   = 2000;
+  double   percent = 10.0;
+  boolean  failed  = false;
+  int      i;
+
+  for(i=1; (i < argc) && (argv[i][0] == '-'); i++) {
+    if(i + 1 >= argc) break;
+    if(!strcmp(argv[i], "-n")) {
+      ticks = atol(argv[++i]);
+    } else if(!strcmp(argv[i], "-c")) {
+      if(!readRef(argv[++i])) return 2;
+    } else if(!strcmp(argv[i], "-t")) {
+      percent = atof(argv[++i]);
+    } else break;
+  }
+  if((i < argc) && (argv[i][0] == '-')) {
+    fprintf(stderr, "usage: %s [-n <ticks>] [-c <reference.csv>] "
+      "[-t <percent>] [<name> ...]\n", argv[0]);
+    return 2;
+  }
+  if(ticks < 1)     ticks = 1;
+  if(ticks > 30000) ticks = 30000; // Frame count must fit the capture
+
+  printf("# ws2801bench, %lu ticks of 1ms, %d LEDs\n",
+    (unsigned long)ticks, BENCH_LEDS);
+  printf("name,us,ticks,frames,bytes,bus_us,bus_tick,crc\n");
+  for(size_t n=0; n<sizeof(strands)/sizeof(strands[0]); n++) {
+    for(uint8_t s=0; s<SCENARIOS; s++) {
+      Result r;
+      snprintf(r.name, sizeof(r.name), "%s/%s", strands[n].name,
+        scenarioName[s]);
+      if(!selected(argc, argv, i, strands[n].name, scenarioName[s], r.name))
+        continue;
+      strands[n].run(s, ticks, &r);
+      printf("%s,%.3f,%lu,%lu,%lu,%lu,%.2f,%08x\n", r.name, r.us, r.ticks,
+        r.frames, r.bytes, r.bus, (double)r.bus / r.ticks, (unsigned)r.crc);
+      fflush(stdout);
+      if(refCount) failed |= compare(&r, percent);
+    }
+  }
+  WS2801Capture::reset();
+  return failed ? 1 : 0;
+}
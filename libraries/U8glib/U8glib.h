@@ -107,6 +107,16 @@ class U8GLIB : public Print
     void firstPage(void) { cbegin(); u8g_FirstPage(&u8g); }
     uint8_t nextPage(void) { return u8g_NextPage(&u8g); }
     
+     /* display list: record the body of the picture loop once and render all pages from the list */
+    void setDisplayList(u8g_dl_t *dl, uint8_t *buf, uint16_t size) { u8g_dl_Init(dl, buf, size); u8g_SetDisplayList(&u8g, dl); }
+    void undoDisplayList(void) { u8g_SetDisplayList(&u8g, NULL); }
+
+     /* I2C transmit queue (AVR hardware TWI): pages are sent by the TWI interrupt while the next page is rendered */
+    void setI2CQueue(uint8_t *buf, uint8_t size) { u8g_i2c_queue_init(buf, size); }
+    void undoI2CQueue(void) { u8g_i2c_queue_init(NULL, 0); }
+    uint8_t waitI2CQueue(void) { return u8g_i2c_queue_wait(); }
+    uint16_t getI2CSpeed(void) { return u8g_i2c_get_speed(); }	/* KHz, see U8G_I2C_OPT_PROBE */
+
     /* system commands */
     uint8_t setContrast(uint8_t contrast) { cbegin(); return u8g_SetContrast(&u8g, contrast); }
     void sleepOn(void) { u8g_SleepOn(&u8g); }
@@ -147,6 +157,8 @@ class U8GLIB : public Print
 
     void drawTriangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) 
       { u8g_DrawTriangle(&u8g, x0, y0, x1, y1, x2, y2); }
+    void drawPolygon(const struct pg_point_struct *list, uint8_t cnt)
+      { u8g_DrawPolygonList(&u8g, list, cnt); }
       
 
     
@@ -160,10 +172,14 @@ class U8GLIB : public Print
       { u8g_DrawXBM(&u8g, x, y, w, h, bitmap); }
     void drawXBMP(u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap)
       { u8g_DrawXBMP(&u8g, x, y, w, h, bitmap); }
+    void drawZBMP(u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *bitmap)
+      { u8g_DrawZBMP(&u8g, x, y, bitmap); }
     
       
     /* font handling */
     void setFont(const u8g_fntpgm_uint8_t *font) {u8g_SetFont(&u8g, font); }
+    void addFontIndex(u8g_font_index_t *fi, const u8g_fntpgm_uint8_t *font, uint16_t *buf, uint8_t cnt) 
+      { u8g_font_index_Init(fi, font, buf, cnt); u8g_AddFontIndex(&u8g, fi); }
     int8_t getFontAscent(void) { return u8g_GetFontAscent(&u8g); }
     int8_t getFontDescent(void) { return u8g_GetFontDescent(&u8g); }
     int8_t getFontLineSpacing(void) { return u8g_GetFontLineSpacing(&u8g); }
@@ -192,6 +208,9 @@ class U8GLIB : public Print
     u8g_uint_t getStrPixelWidthP(u8g_pgm_uint8_t *s) { return u8g_GetStrPixelWidthP(&u8g, s); }
     u8g_uint_t getStrWidth(const char *s) { return u8g_GetStrWidth(&u8g, s); } 
     u8g_uint_t getStrWidthP(u8g_pgm_uint8_t *s) { return u8g_GetStrWidthP(&u8g, s); }
+    u8g_uint_t getStrSize(const char *s, int8_t *ascent, int8_t *descent) { return u8g_GetStrSize(&u8g, s, ascent, descent); }
+    void setStrCache(u8g_sc_t *sc, u8g_sc_entry_t *buf, uint8_t cnt) { u8g_sc_Init(sc, buf, cnt); u8g_SetStrCache(&u8g, sc); }
+    void undoStrCache(void) { u8g_SetStrCache(&u8g, NULL); }
     
     void setHardwareBackup(u8g_state_cb backup_cb) { u8g_SetHardwareBackup(&u8g, backup_cb); }
     
@@ -205,6 +224,7 @@ class U8GLIB : public Print
     
     u8g_uint_t getStrPixelWidth(const __FlashStringHelper *s) { return u8g_GetStrPixelWidthP(&u8g, (u8g_pgm_uint8_t *)s); }
     u8g_uint_t getStrWidth(const __FlashStringHelper *s) { return u8g_GetStrWidthP(&u8g, (u8g_pgm_uint8_t *)s); }
+    u8g_uint_t getStrSize(const __FlashStringHelper *s, int8_t *ascent, int8_t *descent) { return u8g_GetStrSizeP(&u8g, (u8g_pgm_uint8_t *)s, ascent, descent); }
 #endif
 
     /* cursor handling */
@@ -898,6 +918,22 @@ class U8GLIB_SSD1306_128X64_2X : public U8GLIB
       { }
 };
 
+/* full frame buffer (1024 bytes RAM): the frame is kept between picture loops, only changed pages are transfered */
+class U8GLIB_SSD1306_128X64_FB : public U8GLIB 
+{
+  public:
+    U8GLIB_SSD1306_128X64_FB(uint8_t sck, uint8_t mosi, uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) 
+      : U8GLIB(&u8g_dev_ssd1306_128x64_fb_sw_spi, sck, mosi, cs, a0, reset)
+      { }
+    U8GLIB_SSD1306_128X64_FB(uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) 
+      : U8GLIB(&u8g_dev_ssd1306_128x64_fb_hw_spi, cs, a0, reset)
+      { }
+    U8GLIB_SSD1306_128X64_FB(uint8_t options = U8G_I2C_OPT_NONE) 
+      : U8GLIB(&u8g_dev_ssd1306_128x64_fb_i2c, options)
+      { }
+    void clearFrame(void) { u8g_pb64v1_Clear(&u8g_dev_ssd1306_128x64_fb_pb); }
+};
+
 class U8GLIB_SH1106_128X64 : public U8GLIB 
 {
   public:
@@ -926,6 +962,22 @@ class U8GLIB_SH1106_128X64_2X : public U8GLIB
       { }
 };
 
+/* full frame buffer (1024 bytes RAM): the frame is kept between picture loops, only changed pages are transfered */
+class U8GLIB_SH1106_128X64_FB : public U8GLIB 
+{
+  public:
+    U8GLIB_SH1106_128X64_FB(uint8_t sck, uint8_t mosi, uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) 
+      : U8GLIB(&u8g_dev_sh1106_128x64_fb_sw_spi, sck, mosi, cs, a0, reset)
+      { }
+    U8GLIB_SH1106_128X64_FB(uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) 
+      : U8GLIB(&u8g_dev_sh1106_128x64_fb_hw_spi, cs, a0, reset)
+      { }
+    U8GLIB_SH1106_128X64_FB(uint8_t options = U8G_I2C_OPT_NONE) 
+      : U8GLIB(&u8g_dev_sh1106_128x64_fb_i2c, options)
+      { }
+    void clearFrame(void) { u8g_pb64v1_Clear(&u8g_dev_sh1106_128x64_fb_pb); }
+};
+
 class U8GLIB_SSD1309_128X64 : public U8GLIB 
 {
   public:
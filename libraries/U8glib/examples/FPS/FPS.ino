@@ -224,6 +224,10 @@
 uint8_t flip_color = 0;
 uint8_t draw_color = 1;
 
+// display list for the "draw text (list)" test: the draw procedure runs once per frame
+u8g_dl_t dl;
+uint8_t dl_buf[128];
+
 void draw_set_screen(void) {
   // graphic commands to redraw the complete screen should be placed here  
   if ( u8g.getMode() == U8G_MODE_HICOLOR ) {
@@ -302,6 +306,25 @@ void draw_char(void) {
   
 }
 
+void draw_text(void) {
+  u8g_uint_t i;
+  // some lines of text, like a status screen
+  if ( u8g.getMode() == U8G_MODE_HICOLOR ) {
+    u8g.setHiColorByRGB(255,255,255);
+  }
+  else {
+    u8g.setColorIndex(draw_color);
+  }
+  u8g.setFont(u8g_font_6x10);
+  for( i = 0; i < 5; i++ ) {
+    u8g.setPrintPos(0, 10+i*12);
+    u8g.print("Line ");
+    u8g.print(i);
+    u8g.print(": ");
+    u8g.print(millis()/1000);
+  }
+}
+
 void draw_pixel(void) {
   u8g_uint_t x, y, w2, h2;
   if ( u8g.getMode() == U8G_MODE_HICOLOR ) {
@@ -354,6 +377,14 @@ const char *convert_FPS(uint16_t fps) {
   return buf;
 }
 
+const char *convert_ms(uint16_t fps) {
+  static char buf[10];
+  // milliseconds per frame (CPU and transfer)
+  strcpy(buf, u8g_u16toa( fps ? 10000/fps : 0, 5));
+  strcat(buf, " ms");
+  return buf;
+}
+
 void show_result(const char *s, uint16_t fps) {
   // assign default color value
   if ( u8g.getMode() == U8G_MODE_HICOLOR ) {
@@ -367,6 +398,7 @@ void show_result(const char *s, uint16_t fps) {
   do {
     u8g.drawStr(0,12, s);
     u8g.drawStr(0,24, convert_FPS(fps));
+    u8g.drawStr(0,36, convert_ms(fps));
   } while( u8g.nextPage() );
 }
 
@@ -400,5 +432,13 @@ void loop(void) {
   fps = picture_loop_with_fps(draw_pixel);
   show_result("draw pixel", fps);
   delay(5000);
+  fps = picture_loop_with_fps(draw_text);
+  show_result("draw text", fps);
+  delay(5000);
+  u8g.setDisplayList(&dl, dl_buf, sizeof(dl_buf));
+  fps = picture_loop_with_fps(draw_text);
+  u8g.undoDisplayList();
+  show_result("draw text (list)", fps);
+  delay(5000);
 }
 
@@ -0,0 +1,129 @@
+/*
+
+  I2CQueue.pde
+  
+  Measure the CPU time per frame with and without the I2C transmit queue.
+  
+  Without the queue, the CPU waits for every byte on the bus. With the queue, 
+  a page is copied into the queue and sent by the TWI interrupt while the next 
+  page is rendered. The time until the picture loop returns is measured for 
+  both cases, the difference is the CPU time which is freed per frame. 
+  The remaining transfer time of the last page ("bus") is measured separately.
+  
+  >>> Before compiling: Please remove comment from the constructor of the 
+  >>> connected graphics display (see below).
+  >>> AVR with hardware TWI only. Uncomment U8G_WITH_I2C_QUEUE in utility/u8g.h,
+  >>> this can not be used together with the Wire library.
+  
+  Universal 8bit Graphics Library, https://github.com/olikraus/u8glib/
+  
+  Copyright (c) 2012, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, 
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list 
+    of conditions and the following disclaimer.
+    
+  * Redistributions in binary form must reproduce the above copyright notice, this 
+    list of conditions and the following disclaimer in the documentation and/or other 
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT 
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  
+  
+*/
+
+
+#include "U8glib.h"
+
+// setup u8g object, please remove comment from one of the following constructor calls
+//U8GLIB_SSD1306_128X64 u8g(U8G_I2C_OPT_NONE|U8G_I2C_OPT_DEV_0);	// I2C / TWI 
+//U8GLIB_SSD1306_128X64 u8g(U8G_I2C_OPT_DEV_0|U8G_I2C_OPT_FAST);	// Fast I2C / TWI 
+//U8GLIB_SH1106_128X64 u8g(U8G_I2C_OPT_NONE);	// I2C / TWI 
+//U8GLIB_SH1106_128X64 u8g(U8G_I2C_OPT_DEV_0|U8G_I2C_OPT_FAST);	// Dev 0, Fast I2C / TWI
+//U8GLIB_SH1106_128X64 u8g(U8G_I2C_OPT_PROBE);	// I2C / TWI, use the fastest speed up to 1MHz which works
+
+#define FRAMES 50
+
+// one page of the SSD1306/SH1106 (command prefix and 128 data bytes) requires about 150 bytes
+uint8_t queue_buf[150];
+
+uint32_t frame_sync;
+uint32_t frame_queue;
+uint32_t frame_bus;
+
+void draw(void) {
+  u8g_uint_t i;
+  u8g.setFont(u8g_font_6x10);
+  for( i = 0; i < 5; i++ ) {
+    u8g.setPrintPos(0, 10+i*12);
+    u8g.print("Line ");
+    u8g.print(i);
+    u8g.print(": ");
+    u8g.print(millis());
+  }
+}
+
+// average time (us) until the picture loop returns
+uint32_t measure(void) {
+  uint32_t t;
+  uint8_t i;
+  
+  t = micros();
+  for( i = 0; i < FRAMES; i++ ) {
+    u8g.firstPage();  
+    do {
+      draw();
+    } while( u8g.nextPage() );
+  }
+  return (micros() - t) / FRAMES;
+}
+
+void show(const char *s, uint32_t us) {
+  Serial.print(s);
+  Serial.print(us);
+  Serial.println(" us");
+}
+
+void setup(void) {
+  Serial.begin(9600);
+}
+
+void loop(void) {
+  uint32_t t;
+  
+  u8g.undoI2CQueue();
+  frame_sync = measure();
+  
+  u8g.setI2CQueue(queue_buf, sizeof(queue_buf));
+  frame_queue = measure();
+  t = micros();
+  u8g.waitI2CQueue();
+  frame_bus = micros() - t;
+  
+  show("cpu per frame, no queue: ", frame_sync);
+  show("cpu per frame, queue:    ", frame_queue);
+  show("cpu time freed:          ", frame_sync - frame_queue);
+  show("bus after last page:     ", frame_bus);
+  Serial.print("bus speed:               ");
+  Serial.print(u8g.getI2CSpeed());
+  Serial.println(" KHz");
+  if ( u8g_i2c_get_error() != U8G_I2C_ERR_NONE ) {
+    Serial.print("i2c error at position ");
+    Serial.println(u8g_i2c_get_err_pos());
+  }
+  delay(2000);
+}
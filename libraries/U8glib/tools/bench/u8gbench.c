@@ -0,0 +1,508 @@
+/*
+
+  u8gbench.c
+
+  Host benchmark for the u8glib core. Each benchmark draws one kind of 
+  primitive over the full picture loop of a 128x64 page buffer device. 
+  The device is derived from u8g_dev_gprof, but sends every page like 
+  the SSD1306/SH1106 to a counting com procedure.
+  
+  Measured per frame:
+    us		time (average over all frames)
+    calls	number of device procedure calls (all messages)
+    pixel	number of drawing messages (pixel, 8 pixel, box, glyph)
+    com		bytes sent to the com procedure
+  
+  The results are written as CSV to stdout. The count values do not depend
+  on the host, so they are exact for a comparison between versions.
+
+  Usage:
+    u8gbench [-n <frames>] [-c <reference.csv>] [-t <percent>] [<benchmark> ...]
+
+    -n  number of frames for each benchmark (default 200)
+    -c  compare with a previous result: changed counts and benchmarks which 
+        are more than <percent> (default 10) slower are reported to stderr,
+        the exit code is 1 if a benchmark is slower
+    Without benchmark names, all benchmarks are executed.
+
+  u8gbench.csv is the result of the build below. After a change, 
+  'u8gbench -c u8gbench.csv' should not report changed counts, unless 
+  the output is meant to change. The 'us' column is from one PC, so raise 
+  -t when comparing on another host.
+
+  Build:
+    cc -O2 -I../../utility -o u8gbench u8gbench.c ../../utility/u8g*.c
+
+  The glyph, str, str_rot and hud benchmarks need the fonts, which are not
+  part of this tree: add u8g_font_data.c of the u8glib distribution and
+  -DU8GBENCH_FONTS to the build.
+
+  Universal 8bit Graphics Library
+  
+  Copyright (c) 2011, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "u8g.h"
+
+/*========================================================================*/
+/* counting device */
+
+#define WIDTH 128
+#define HEIGHT 64
+#define PAGE_HEIGHT 8
+
+unsigned long bench_calls;
+unsigned long bench_pixel;
+unsigned long bench_com;
+
+uint8_t u8g_com_bench_fn(u8g_t *u8g, uint8_t msg, uint8_t arg_val, void *arg_ptr)
+{
+  (void)u8g;
+  (void)arg_ptr;
+  switch(msg)
+  {
+    case U8G_COM_MSG_WRITE_BYTE:
+      bench_com++;
+      break;
+    case U8G_COM_MSG_WRITE_SEQ:
+    case U8G_COM_MSG_WRITE_SEQ_P:
+      bench_com += arg_val;
+      break;
+  }
+  return 1;
+}
+
+uint8_t u8g_dev_bench_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+  u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+  
+  bench_calls++;
+  switch(msg)
+  {
+    case U8G_DEV_MSG_SET_PIXEL:
+    case U8G_DEV_MSG_SET_8PIXEL:
+    case U8G_DEV_MSG_SET_BOX:
+    case U8G_DEV_MSG_SET_VGLYPH:
+      bench_pixel++;
+      break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      /* same transfer as the SSD1306/SH1106 devices, without the skipping of unchanged pages */
+      u8g_SetChipSelect(u8g, dev, 1);
+      u8g_SetAddress(u8g, dev, 0);
+      u8g_WriteByte(u8g, dev, 0x010);
+      u8g_WriteByte(u8g, dev, 0x002);
+      u8g_WriteByte(u8g, dev, 0x0b0 | pb->p.page);
+      u8g_SetAddress(u8g, dev, 1);
+      u8g_pb_WriteBuffer(pb, u8g, dev);
+      u8g_SetChipSelect(u8g, dev, 0);
+      break;
+  }
+  return u8g_dev_pb8v1_base_fn(u8g, dev, msg, arg);
+}
+
+U8G_PB_DEV(u8g_dev_bench, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_bench_fn, u8g_com_bench_fn);
+
+/*========================================================================*/
+/* benchmarks, each procedure is the body of the picture loop */
+
+u8g_t u8g;
+
+static const uint8_t bench_xbm[] U8G_PROGMEM = {
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x80, 0xf9, 0xff, 0xff, 0x9f,
+  0x09, 0x00, 0x00, 0x90, 0xe9, 0xff, 0xff, 0x97, 0x29, 0x00, 0x00, 0x94,
+  0xa9, 0xff, 0xff, 0x95, 0xa9, 0x00, 0x00, 0x95, 0xa9, 0xfe, 0x7f, 0x95,
+  0xa9, 0x02, 0x40, 0x95, 0xa9, 0xfa, 0x5f, 0x95, 0xa9, 0x0a, 0x50, 0x95,
+  0xa9, 0xea, 0x57, 0x95, 0xa9, 0x2a, 0x54, 0x95, 0xa9, 0xaa, 0x55, 0x95,
+  0xa9, 0xaa, 0x55, 0x95, 0xa9, 0xaa, 0x55, 0x95, 0xa9, 0xaa, 0x55, 0x95,
+  0xa9, 0x2a, 0x54, 0x95, 0xa9, 0xea, 0x57, 0x95, 0xa9, 0x0a, 0x50, 0x95,
+  0xa9, 0xfa, 0x5f, 0x95, 0xa9, 0x02, 0x40, 0x95, 0xa9, 0xfe, 0x7f, 0x95,
+  0xa9, 0x00, 0x00, 0x95, 0xa9, 0xff, 0xff, 0x95, 0x29, 0x00, 0x00, 0x94,
+  0xe9, 0xff, 0xff, 0x97, 0x09, 0x00, 0x00, 0x90, 0xf9, 0xff, 0xff, 0x9f,
+  0x01, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff };
+
+/* 
+  128x64 splash screen (ring logo, text and bar), compressed with 
+  tools/bitmap/u8gzbmp.c and 8 rows per block: 359 instead of 1024 bytes 
+*/
+static const uint8_t bench_zbm[] U8G_PROGMEM = {
+  0x00, 0x80, 0x00, 0x40, 0x08, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x2f, 0x00,
+  0x83, 0x00, 0xce, 0x00, 0xfc, 0x01, 0x3f, 0x01, 0x5d, 0x8d, 0xff, 0x00,
+  0x80, 0x8b, 0x00, 0x00, 0x01, 0xff, 0xdd, 0x00, 0x80, 0x8b, 0x00, 0x00,
+  0x01, 0xff, 0xcf, 0x01, 0x0f, 0xf8, 0xcc, 0x01, 0x7f, 0xff, 0xca, 0x04,
+  0x80, 0x01, 0xff, 0xff, 0xc0, 0x87, 0x00, 0x02, 0x01, 0x80, 0x03, 0xc0,
+  0x05, 0xe0, 0x00, 0x40, 0x04, 0x00, 0x08, 0xc5, 0x00, 0x07, 0xc0, 0x00,
+  0xf0, 0xc3, 0x00, 0x01, 0xc4, 0x00, 0x0f, 0xc0, 0x00, 0xf8, 0xc0, 0x00,
+  0x00, 0xc7, 0x00, 0x1f, 0xc0, 0x00, 0xfc, 0xc0, 0x04, 0x1c, 0x07, 0x4b,
+  0xc7, 0xe0, 0xc3, 0x00, 0x3f, 0xc0, 0x00, 0xfe, 0xc0, 0x03, 0x04, 0x08,
+  0xcc, 0x61, 0x81, 0x00, 0xc0, 0x03, 0x7f, 0xf8, 0x0f, 0xff, 0xc1, 0x02,
+  0x10, 0x48, 0x21, 0xc4, 0x04, 0xff, 0xe0, 0x03, 0xff, 0x80, 0xc8, 0x0a,
+  0x80, 0xff, 0xc0, 0x01, 0xff, 0x80, 0x40, 0x04, 0x10, 0x48, 0x21, 0x81,
+  0x00, 0x06, 0x01, 0x81, 0xff, 0x80, 0x00, 0xff, 0xc0, 0xca, 0x02, 0x00,
+  0x00, 0x7f, 0xc1, 0x01, 0x08, 0xc8, 0xc5, 0x00, 0xfe, 0xc0, 0x07, 0x3f,
+  0xc0, 0x7f, 0x3f, 0x87, 0x48, 0x20, 0xe0, 0xc2, 0x00, 0x83, 0xc2, 0x00,
+  0xe0, 0x80, 0x00, 0x00, 0x40, 0x82, 0x00, 0xc0, 0x00, 0xfc, 0xc0, 0x00,
+  0x1f, 0xc1, 0x01, 0x08, 0xc0, 0xcc, 0x01, 0x07, 0x80, 0xcc, 0x84, 0x00,
+  0x00, 0x01, 0x05, 0x83, 0xfc, 0x00, 0x00, 0x1f, 0xe0, 0x86, 0x00, 0x00,
+  0x01, 0xef, 0x00, 0xfe, 0xc0, 0x03, 0x3f, 0xe0, 0x04, 0x01, 0xc6, 0x00,
+  0x81, 0xc2, 0x01, 0xc0, 0x04, 0x85, 0x00, 0xc0, 0x00, 0xff, 0xc0, 0x00,
+  0x7f, 0xcb, 0x07, 0x80, 0x00, 0xff, 0xc0, 0x3d, 0x13, 0x16, 0x38, 0xc4,
+  0x09, 0x80, 0xff, 0xc0, 0x01, 0xff, 0x80, 0x45, 0x11, 0x19, 0x44, 0x82,
+  0x00, 0x00, 0x01, 0xc0, 0x01, 0xe0, 0x03, 0xc2, 0x00, 0x11, 0xc6, 0x04,
+  0x7f, 0xf8, 0x0f, 0xff, 0x00, 0xc9, 0x08, 0x3f, 0xff, 0xff, 0xfe, 0x00,
+  0x3c, 0xf7, 0xd1, 0x38, 0xc5, 0x00, 0x1f, 0xc0, 0x00, 0xfc, 0x87, 0x00,
+  0xc0, 0x00, 0x0f, 0xc0, 0x00, 0xf8, 0xca, 0x00, 0x07, 0xc0, 0x00, 0xf0,
+  0xca, 0x00, 0x03, 0xc0, 0x00, 0xe0, 0xc9, 0x04, 0x80, 0x01, 0xff, 0xff,
+  0xc0, 0x87, 0x00, 0x04, 0x01, 0x80, 0x00, 0x7f, 0xff, 0x88, 0x00, 0xc1,
+  0x01, 0x0f, 0xf8, 0xc0, 0x86, 0xff, 0xc1, 0x81, 0x00, 0xee, 0x86, 0x00,
+  0xcf, 0x00, 0x80, 0x8b, 0x00, 0x00, 0x01, 0xff, 0xdd, 0x8d, 0xff };
+
+#ifdef U8GBENCH_FONTS
+
+/* all glyphs 32..126 of the current font, line by line */
+static void bench_glyphs(void)
+{
+  char buf[2] = " ";
+  u8g_uint_t x = 0, y;
+  int c;
+  
+  y = u8g_GetFontAscent(&u8g);
+  for( c = 32; c < 127; c++ )
+  {
+    buf[0] = c;
+    if ( x + u8g_GetStrWidth(&u8g, buf) > WIDTH )
+    {
+      x = 0;
+      y += u8g_GetFontLineSpacing(&u8g);
+    }
+    x += u8g_DrawStr(&u8g, x, y, buf);
+  }
+}
+
+static void bench_glyph_5x7(void) { u8g_SetFont(&u8g, u8g_font_5x7); bench_glyphs(); }
+static void bench_glyph_6x10(void) { u8g_SetFont(&u8g, u8g_font_6x10); bench_glyphs(); }
+static void bench_glyph_8x13B(void) { u8g_SetFont(&u8g, u8g_font_8x13B); bench_glyphs(); }
+static void bench_glyph_9x15(void) { u8g_SetFont(&u8g, u8g_font_9x15); bench_glyphs(); }
+
+static void bench_str(void)
+{
+  u8g_uint_t y;
+  u8g_SetFont(&u8g, u8g_font_6x10);
+  for( y = 10; y < HEIGHT; y += 10 )
+    u8g_DrawStr(&u8g, 0, y, "Hello World! 0123456789");
+}
+
+static void bench_str_rot(void)
+{
+  u8g_SetFont(&u8g, u8g_font_6x10);
+  u8g_DrawStr90(&u8g, 10, 0, "Rotated 90");
+  u8g_DrawStr180(&u8g, 100, 20, "Rotated 180");
+  u8g_DrawStr270(&u8g, 118, 63, "Rotated 270");
+  u8g_DrawStr180(&u8g, 100, 50, "Rotated 180");
+}
+
+#endif /* U8GBENCH_FONTS */
+
+static void bench_box(void)
+{
+  u8g_uint_t i;
+  u8g_DrawBox(&u8g, 0, 0, WIDTH, HEIGHT);
+  u8g_SetColorIndex(&u8g, 0);
+  for( i = 0; i < 16; i++ )
+    u8g_DrawBox(&u8g, i*8, i*4, 7, 3+i);
+  u8g_SetColorIndex(&u8g, 1);
+}
+
+static void bench_frame(void)
+{
+  u8g_uint_t i;
+  for( i = 0; i < 30; i += 3 )
+    u8g_DrawFrame(&u8g, i, i, WIDTH-2*i, HEIGHT-2*i);
+}
+
+static void bench_line(void)
+{
+  u8g_uint_t i;
+  for( i = 0; i < WIDTH; i += 8 )
+  {
+    u8g_DrawLine(&u8g, WIDTH/2, HEIGHT/2, i, 0);
+    u8g_DrawLine(&u8g, WIDTH/2, HEIGHT/2, i, HEIGHT-1);
+  }
+  for( i = 0; i < HEIGHT; i += 8 )
+  {
+    u8g_DrawLine(&u8g, WIDTH/2, HEIGHT/2, 0, i);
+    u8g_DrawLine(&u8g, WIDTH/2, HEIGHT/2, WIDTH-1, i);
+  }
+}
+
+static void bench_circle(void)
+{
+  u8g_uint_t r;
+  for( r = 4; r < 40; r += 4 )
+    u8g_DrawCircle(&u8g, WIDTH/2, HEIGHT/2, r, U8G_DRAW_ALL);
+}
+
+static void bench_disc(void)
+{
+  u8g_DrawDisc(&u8g, 20, 20, 18, U8G_DRAW_ALL);
+  u8g_DrawDisc(&u8g, 64, 32, 30, U8G_DRAW_ALL);
+  u8g_DrawDisc(&u8g, 110, 50, 12, U8G_DRAW_ALL);
+  u8g_DrawFilledEllipse(&u8g, 64, 32, 60, 20, U8G_DRAW_ALL);
+}
+
+static void bench_xbmp(void)
+{
+  u8g_uint_t x;
+  for( x = 0; x < WIDTH; x += 32 )
+  {
+    u8g_DrawXBMP(&u8g, x, 0, 32, 32, bench_xbm);
+    u8g_DrawXBMP(&u8g, x+5, 32, 32, 32, bench_xbm);
+  }
+}
+
+static void bench_zbmp(void)
+{
+  u8g_DrawZBMP(&u8g, 0, 0, bench_zbm);
+}
+
+static void bench_polygon(void)
+{
+  u8g_DrawTriangle(&u8g, 0, 0, 60, 10, 20, 63);
+  u8g_DrawTriangle(&u8g, 127, 0, 70, 30, 120, 63);
+  u8g_ClearPolygonXY();
+  u8g_AddPolygonXY(&u8g, 40, 5);
+  u8g_AddPolygonXY(&u8g, 90, 15);
+  u8g_AddPolygonXY(&u8g, 80, 60);
+  u8g_AddPolygonXY(&u8g, 30, 50);
+  u8g_DrawPolygon(&u8g);
+}
+
+#ifdef U8GBENCH_FONTS
+
+/* the status screen of the Lightduino sketch */
+static void bench_hud(void)
+{
+  u8g_SetFont(&u8g, u8g_font_6x10);
+  u8g_DrawStr(&u8g, 0, 10, "Blue");
+  u8g_SetFont(&u8g, u8g_font_5x7);
+  u8g_DrawStr(&u8g, 6, 25, "Charges");
+  u8g_DrawStr(&u8g, 78, 25, "Energy");
+  u8g_DrawStr(&u8g, 128 - u8g_GetStrWidth(&u8g, "Pistol"), 10, "Pistol");
+  u8g_DrawStr(&u8g, 34, 62, "Hit by ");
+  u8g_DrawStr(&u8g, 69, 62, "Red");
+  u8g_SetFont(&u8g, u8g_font_9x15);
+  u8g_DrawStr(&u8g, 0, 38, "12");
+  u8g_DrawStr(&u8g, 18, 38, "/");
+  u8g_DrawStr(&u8g, 27, 38, "30");
+  u8g_DrawStr(&u8g, 60, 38, "97");
+  u8g_DrawStr(&u8g, 87, 38, "/120");
+}
+
+#endif /* U8GBENCH_FONTS */
+
+struct bench_struct
+{
+  const char *name;
+  void (*draw)(void);
+};
+
+static const struct bench_struct bench_list[] = 
+{
+#ifdef U8GBENCH_FONTS
+  { "glyph_5x7", bench_glyph_5x7 },
+  { "glyph_6x10", bench_glyph_6x10 },
+  { "glyph_8x13B", bench_glyph_8x13B },
+  { "glyph_9x15", bench_glyph_9x15 },
+  { "str", bench_str },
+  { "str_rot", bench_str_rot },
+#endif
+  { "box", bench_box },
+  { "frame", bench_frame },
+  { "line", bench_line },
+  { "circle", bench_circle },
+  { "disc", bench_disc },
+  { "xbmp", bench_xbmp },
+  { "zbmp", bench_zbmp },
+  { "polygon", bench_polygon },
+#ifdef U8GBENCH_FONTS
+  { "hud", bench_hud },
+#endif
+  { NULL, NULL }
+};
+
+/*========================================================================*/
+/* measurement and reference data */
+
+struct result_struct
+{
+  char name[32];
+  double us;
+  unsigned long calls, pixel, com;
+};
+
+struct result_struct ref[64];
+int ref_cnt;
+
+static double now_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void run(const struct bench_struct *b, int frames, struct result_struct *r)
+{
+  double t;
+  int i;
+  
+  /* one frame to warm up the caches */
+  u8g_FirstPage(&u8g);
+  do { b->draw(); } while( u8g_NextPage(&u8g) );
+  
+  bench_calls = 0;
+  bench_pixel = 0;
+  bench_com = 0;
+  t = now_us();
+  for( i = 0; i < frames; i++ )
+  {
+    u8g_FirstPage(&u8g);
+    do { b->draw(); } while( u8g_NextPage(&u8g) );
+  }
+  t = now_us() - t;
+  
+  strncpy(r->name, b->name, sizeof(r->name)-1);
+  r->name[sizeof(r->name)-1] = '\0';
+  r->us = t / frames;
+  r->calls = bench_calls / frames;
+  r->pixel = bench_pixel / frames;
+  r->com = bench_com / frames;
+}
+
+static int read_ref(const char *name)
+{
+  char line[256];
+  FILE *fp = fopen(name, "r");
+  if ( fp == NULL )
+  {
+    perror(name);
+    return 0;
+  }
+  while( ref_cnt < 64 && fgets(line, sizeof(line), fp) != NULL )
+  {
+    struct result_struct *r = ref + ref_cnt;
+    if ( line[0] == '#' || strncmp(line, "name,", 5) == 0 )
+      continue;
+    if ( sscanf(line, "%31[^,],%lf,%lu,%lu,%lu", r->name, &r->us, &r->calls, &r->pixel, &r->com) == 5 )
+      ref_cnt++;
+  }
+  fclose(fp);
+  return 1;
+}
+
+/* returns 1 if the benchmark is slower than the reference */
+static int compare(const struct result_struct *r, double percent)
+{
+  int i;
+  for( i = 0; i < ref_cnt; i++ )
+  {
+    if ( strcmp(ref[i].name, r->name) == 0 )
+    {
+      if ( ref[i].calls != r->calls || ref[i].pixel != r->pixel || ref[i].com != r->com )
+        fprintf(stderr, "%s: counts changed: calls %lu -> %lu, pixel %lu -> %lu, com %lu -> %lu\n", 
+          r->name, ref[i].calls, r->calls, ref[i].pixel, r->pixel, ref[i].com, r->com);
+      if ( r->us > ref[i].us * (1.0 + percent/100.0) )
+      {
+        fprintf(stderr, "%s: slower: %.2f us -> %.2f us\n", r->name, ref[i].us, r->us);
+        return 1;
+      }
+      return 0;
+    }
+  }
+  fprintf(stderr, "%s: not in reference\n", r->name);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  const struct bench_struct *b;
+  struct result_struct r;
+  int frames = 200;
+  double percent = 10.0;
+  int is_slower = 0;
+  int i, first_name, is_selected;
+  
+  for( i = 1; i < argc && argv[i][0] == '-'; i++ )
+  {
+    if ( i+1 >= argc )
+      break;
+    if ( strcmp(argv[i], "-n") == 0 )
+      frames = atoi(argv[++i]);
+    else if ( strcmp(argv[i], "-c") == 0 )
+    {
+      if ( read_ref(argv[++i]) == 0 )
+        return 2;
+    }
+    else if ( strcmp(argv[i], "-t") == 0 )
+      percent = atof(argv[++i]);
+    else
+      break;
+  }
+  if ( i < argc && argv[i][0] == '-' )
+  {
+    fprintf(stderr, "usage: %s [-n <frames>] [-c <reference.csv>] [-t <percent>] [<benchmark> ...]\n", argv[0]);
+    return 2;
+  }
+  if ( frames < 1 )
+    frames = 1;
+  first_name = i;
+  
+  u8g_Init(&u8g, &u8g_dev_bench);
+  
+  printf("# u8gbench, %d frames, 128x64 pb8v1\n", frames);
+  printf("name,us,calls,pixel,com\n");
+  for( b = bench_list; b->name != NULL; b++ )
+  {
+    is_selected = (first_name >= argc);
+    for( i = first_name; i < argc; i++ )
+      if ( strcmp(argv[i], b->name) == 0 )
+        is_selected = 1;
+    if ( is_selected == 0 )
+      continue;
+    run(b, frames, &r);
+    printf("%s,%.2f,%lu,%lu,%lu\n", r.name, r.us, r.calls, r.pixel, r.com);
+    fflush(stdout);
+    if ( ref_cnt > 0 )
+      is_slower |= compare(&r, percent);
+  }
+  return is_slower;
+}
@@ -0,0 +1,463 @@
+/*
+
+  u8gzbmp.c
+
+  Convert a XBM or PBM (P1/P4) image into a compressed bitmap for 
+  u8g_DrawZBMP(). See u8g_bitmap.c for a description of the format.
+
+  Usage:
+    u8gzbmp [-b <rows per block>] [-n <name>] [-s] [-v] <xbm or pbm file> [<output c file>]
+
+    -b  number of rows, which are packed together (default 8). The decoder
+        starts with the block which contains the first row of the current
+        page. Use the page height of the display (8 for most OLEDs).
+    -n  name of the array (default: name of the XBM data or of the file)
+    -s  fail if the compressed bitmap is not smaller than the uncompressed
+        one, ((w+7)/8*h bytes). Without -s a warning is printed: use
+        u8g_DrawXBMP() for such bitmaps, it is faster.
+    -v  print the size of the uncompressed and the compressed bitmap to stderr
+
+  Example:
+    u8gzbmp -v logo.xbm logo.c
+    ...
+    extern const u8g_pgm_uint8_t logo[];
+    u8g.drawZBMP(0, 0, logo);
+
+  Build:
+    cc -o u8gzbmp u8gzbmp.c
+
+  Universal 8bit Graphics Library
+
+  Copyright (c) 2011, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define BMP_MAX 0x10000
+
+int bmp_w, bmp_h;
+unsigned char bmp[BMP_MAX];		/* (bmp_w+7)/8 bytes per row, highest bit is left */
+unsigned char out[BMP_MAX*2];
+long out_len;
+char bmp_name[256];
+
+/*========================================================================*/
+/* read the image */
+
+char *read_file(const char *name)
+{
+  FILE *fp;
+  char *buf;
+  long len;
+
+  fp = fopen(name, "rb");
+  if ( fp == NULL )
+  {
+    perror(name);
+    return NULL;
+  }
+  fseek(fp, 0, SEEK_END);
+  len = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  buf = malloc(len+1);
+  if ( buf == NULL )
+  {
+    fclose(fp);
+    return NULL;
+  }
+  len = fread(buf, 1, len, fp);
+  buf[len] = '\0';
+  fclose(fp);
+  return buf;
+}
+
+/* value of "#define <something><suffix> <value>" */
+int get_define(const char *buf, const char *suffix)
+{
+  const char *s = buf;
+  const char *p;
+  while( (s = strstr(s, "#define")) != NULL )
+  {
+    s += 7;
+    while( *s == ' ' || *s == '\t' )
+      s++;
+    p = s;
+    while( isalnum((unsigned char)*p) || *p == '_' )
+      p++;
+    if ( p - s >= (long)strlen(suffix) && strncmp(p - strlen(suffix), suffix, strlen(suffix)) == 0 )
+      return atoi(p);
+  }
+  return -1;
+}
+
+unsigned char reverse_bits(unsigned char b)
+{
+  unsigned char r = 0;
+  int i;
+  for( i = 0; i < 8; i++ )
+  {
+    r <<= 1;
+    r |= b & 1;
+    b >>= 1;
+  }
+  return r;
+}
+
+int read_xbm(char *buf)
+{
+  char *s, *p;
+  int i, n;
+
+  bmp_w = get_define(buf, "_width");
+  bmp_h = get_define(buf, "_height");
+  if ( bmp_w <= 0 || bmp_h <= 0 )
+    return 0;
+  n = (bmp_w + 7) / 8 * bmp_h;
+  if ( n > BMP_MAX )
+    return 0;
+
+  s = strstr(buf, "_bits");
+  if ( s == NULL )
+    return 0;
+  /* the name of the data without "_bits" */
+  p = s;
+  while( p > buf && (isalnum((unsigned char)p[-1]) || p[-1] == '_') )
+    p--;
+  if ( bmp_name[0] == '\0' && s - p < (long)sizeof(bmp_name) )
+  {
+    memcpy(bmp_name, p, s - p);
+    bmp_name[s - p] = '\0';
+  }
+  s = strchr(s, '{');
+  if ( s == NULL )
+    return 0;
+  s++;
+  for( i = 0; i < n; i++ )
+  {
+    while( isspace((unsigned char)*s) || *s == ',' )
+      s++;
+    bmp[i] = reverse_bits((unsigned char)strtol(s, &p, 0));
+    if ( p == s )
+      return 0;
+    s = p;
+  }
+  return 1;
+}
+
+/* skip white space and comments of a PBM header */
+char *pbm_skip(char *s)
+{
+  for(;;)
+  {
+    while( isspace((unsigned char)*s) )
+      s++;
+    if ( *s != '#' )
+      return s;
+    while( *s != '\0' && *s != '\n' )
+      s++;
+  }
+}
+
+int read_pbm(char *buf, long len)
+{
+  char *s = buf + 2;
+  int is_raw = buf[1] == '4';
+  int b, x, y;
+
+  s = pbm_skip(s);
+  bmp_w = strtol(s, &s, 10);
+  s = pbm_skip(s);
+  bmp_h = strtol(s, &s, 10);
+  if ( bmp_w <= 0 || bmp_h <= 0 )
+    return 0;
+  b = (bmp_w + 7) / 8;
+  if ( b * bmp_h > BMP_MAX )
+    return 0;
+  memset(bmp, 0, b * bmp_h);
+  if ( is_raw )
+  {
+    s++;		/* single white space */
+    if ( s + b * bmp_h > buf + len )
+      return 0;
+    memcpy(bmp, s, b * bmp_h);
+    return 1;
+  }
+  for( y = 0; y < bmp_h; y++ )
+    for( x = 0; x < bmp_w; x++ )
+    {
+      while( isspace((unsigned char)*s) )
+        s++;
+      if ( *s == '\0' )
+        return 0;
+      if ( *s++ == '1' )
+        bmp[y*b + x/8] |= 128 >> (x & 7);
+    }
+  return 1;
+}
+
+int read_image(const char *name)
+{
+  FILE *fp;
+  char *buf;
+  long len;
+  const char *p;
+  int i;
+
+  buf = read_file(name);
+  if ( buf == NULL )
+    return 0;
+  /* the length is needed for binary PBM files */
+  fp = fopen(name, "rb");
+  fseek(fp, 0, SEEK_END);
+  len = ftell(fp);
+  fclose(fp);
+
+  if ( bmp_name[0] == '\0' && buf[0] == 'P' )
+  {
+    /* use the file name without directory and extension */
+    p = strrchr(name, '/');
+    p = p == NULL ? name : p+1;
+    for( i = 0; p[i] != '\0' && p[i] != '.' && i < (int)sizeof(bmp_name)-1; i++ )
+      bmp_name[i] = isalnum((unsigned char)p[i]) ? p[i] : '_';
+    bmp_name[i] = '\0';
+  }
+  
+  if ( buf[0] == 'P' && (buf[1] == '1' || buf[1] == '4') )
+  {
+    if ( read_pbm(buf, len) )
+      return 1;
+  }
+  else if ( read_xbm(buf) )
+  {
+    return 1;
+  }
+  fprintf(stderr, "%s: not a valid XBM or PBM (P1, P4) file\n", name);
+  return 0;
+}
+
+/*========================================================================*/
+/* packing */
+
+/* 
+  pack the rows of a block (cnt bytes, b bytes per row), 
+  return the number of bytes written to dest 
+*/
+long pack(unsigned char *dest, const unsigned char *src, long cnt, long b)
+{
+  unsigned char *d = dest;
+  long i = 0, lit, run, copy;
+
+  while( i < cnt )
+  {
+    run = 1;
+    while( i + run < cnt && src[i+run] == src[i] && run < 66 )
+      run++;
+    copy = 0;
+    if ( i >= b )
+      while( i + copy < cnt && src[i+copy] == src[i+copy-b] && copy < 65 )
+        copy++;
+    if ( copy >= 2 && copy >= run )
+    {
+      *d++ = copy + 190;
+      i += copy;
+      continue;
+    }
+    if ( run >= 3 )
+    {
+      *d++ = run + 125;
+      *d++ = src[i];
+      i += run;
+      continue;
+    }
+    /* collect bytes until a run of 3 bytes or a copy of 2 bytes is possible */
+    lit = 0;
+    while( i + lit < cnt && lit < 128 )
+    {
+      if ( lit > 0 && i + lit + 2 < cnt && src[i+lit] == src[i+lit+1] && src[i+lit] == src[i+lit+2] )
+        break;
+      if ( lit > 0 && i + lit >= b && i + lit + 1 < cnt && src[i+lit] == src[i+lit-b] && src[i+lit+1] == src[i+lit+1-b] )
+        break;
+      lit++;
+    }
+    *d++ = lit - 1;
+    memcpy(d, src + i, lit);
+    d += lit;
+    i += lit;
+  }
+  return d - dest;
+}
+
+int compress(int rows_per_block)
+{
+  int b = (bmp_w + 7) / 8;
+  int blocks = (bmp_h + rows_per_block - 1) / rows_per_block;
+  int i, rows;
+  long pos;
+
+  /* u8g_DrawZBMP() takes the size as u8g_uint_t, which is 8 bit by default */
+  if ( bmp_w < 1 || bmp_w > 255 || bmp_h < 1 || bmp_h > 255 )
+  {
+    fprintf(stderr, "width and height of the bitmap must be 1..255\n");
+    return 0;
+  }
+
+  out[0] = bmp_w >> 8;
+  out[1] = bmp_w & 255;
+  out[2] = bmp_h >> 8;
+  out[3] = bmp_h & 255;
+  out[4] = rows_per_block;
+  pos = 5 + 2*blocks;
+  for( i = 0; i < blocks; i++ )
+  {
+    if ( pos > 0x0ffff )
+    {
+      fprintf(stderr, "bitmap is too large\n");
+      return 0;
+    }
+    out[5 + 2*i] = pos >> 8;
+    out[6 + 2*i] = pos & 255;
+    rows = bmp_h - i*rows_per_block;
+    if ( rows > rows_per_block )
+      rows = rows_per_block;
+    pos += pack(out + pos, bmp + (long)i*rows_per_block*b, (long)rows*b, b);
+  }
+  out_len = pos;
+  return 1;
+}
+
+void write_bitmap(FILE *fp)
+{
+  long i;
+  fprintf(fp, "#include \"u8g.h\"\n");
+  fprintf(fp, "/* %dx%d */\n", bmp_w, bmp_h);
+  fprintf(fp, "const u8g_pgm_uint8_t %s[%ld] U8G_PROGMEM = {", bmp_name, out_len);
+  for( i = 0; i < out_len; i++ )
+  {
+    if ( (i % 16) == 0 )
+      fprintf(fp, "\n  ");
+    fprintf(fp, "%d", out[i]);
+    if ( i+1 < out_len )
+      fprintf(fp, ",");
+  }
+  fprintf(fp, "};\n");
+}
+
+void usage(const char *prg)
+{
+  fprintf(stderr, "usage: %s [-b <rows per block>] [-n <name>] [-s] [-v] <xbm or pbm file> [<output c file>]\n", prg);
+}
+
+int main(int argc, char **argv)
+{
+  const char *prg = argv[0];
+  int rows_per_block = 8;
+  int is_verbose = 0;
+  int is_strict = 0;
+  long raw;
+  FILE *fp = stdout;
+
+  argc--;
+  argv++;
+  while( argc > 0 && argv[0][0] == '-' )
+  {
+    if ( strcmp(argv[0], "-v") == 0 )
+    {
+      is_verbose = 1;
+      argc--;
+      argv++;
+      continue;
+    }
+    if ( strcmp(argv[0], "-s") == 0 )
+    {
+      is_strict = 1;
+      argc--;
+      argv++;
+      continue;
+    }
+    if ( argc < 2 )
+    {
+      usage(prg);
+      return 1;
+    }
+    if ( strcmp(argv[0], "-b") == 0 )
+      rows_per_block = atoi(argv[1]);
+    else if ( strcmp(argv[0], "-n") == 0 )
+    {
+      strncpy(bmp_name, argv[1], sizeof(bmp_name)-1);
+      bmp_name[sizeof(bmp_name)-1] = '\0';
+    }
+    else
+    {
+      usage(prg);
+      return 1;
+    }
+    argc -= 2;
+    argv += 2;
+  }
+  if ( argc < 1 || rows_per_block < 1 || rows_per_block > 255 )
+  {
+    usage(prg);
+    return 1;
+  }
+  if ( read_image(argv[0]) == 0 )
+    return 1;
+  if ( compress(rows_per_block) == 0 )
+    return 1;
+  raw = (long)(bmp_w + 7) / 8 * bmp_h;
+  if ( out_len >= raw )
+  {
+    fprintf(stderr, "%s: compressed bitmap (%ld bytes) is not smaller than the uncompressed bitmap (%ld bytes)\n", 
+      bmp_name, out_len, raw);
+    if ( is_strict )
+      return 1;
+  }
+
+  if ( argc > 1 )
+  {
+    fp = fopen(argv[1], "w");
+    if ( fp == NULL )
+    {
+      perror(argv[1]);
+      return 1;
+    }
+  }
+  write_bitmap(fp);
+  if ( fp != stdout )
+    fclose(fp);
+
+  if ( is_verbose )
+  {
+    fprintf(stderr, "%s: %dx%d, %ld --> %ld bytes (%ld%%)\n", bmp_name, bmp_w, bmp_h, raw, out_len, 
+      (out_len * 100 + raw/2) / raw);
+  }
+  return 0;
+}
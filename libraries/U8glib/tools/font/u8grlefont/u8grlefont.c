@@ -0,0 +1,440 @@
+/*
+
+  u8grlefont.c
+
+  Convert u8g fonts (format 0, 1 or 2) into run length encoded format 4 fonts.
+
+  Format 4 uses the glyph information of format 0, the data size is the
+  number of bytes of the run length encoded bitmap. The bitmap is a sequence
+  of pairs: a run of 0 pixel followed by a run of 1 pixel, taken row by row
+  without padding. Trailing 0 pixel are not stored. All bits are stored
+  starting with the lowest bit of a byte.
+  The font information gets one additional byte (offset 17): bit 0..2 is the
+  number of bits for a 0 run, bit 3..5 the number of bits for a 1 run. If bit
+  6 is set, each pair is followed by repeat flags: as long as the flag is 1,
+  the pair is used again. The values which give the smallest font are used.
+
+  Usage:
+    u8grlefont [-v] <u8g font c file> [<output c file>]
+
+  All fonts of the input file are converted. The name of the converted font
+  gets the suffix "z", e.g. u8g_font_6x10 --> u8g_font_6x10z.
+  Add "extern const u8g_fntpgm_uint8_t u8g_font_6x10z[];" to the sketch and
+  uncomment U8G_WITH_RLE_FONT in u8g.h. The decoder adds about 1 KB of code
+  and draws the glyphs about 1.7 times slower, so converting pays off only if
+  the fonts save more than about 2 KB: a 24 pixel DejaVu Sans font shrinks by
+  1.1 KB (no gain), a 32 pixel one by 2 KB. Small fonts like 6x10 or 9x15
+  save a few hundred bytes, less than the size of the decoder.
+  The output includes u8g.h and stops the build with #error if
+  U8G_WITH_RLE_FONT is not defined.
+  -v prints the size of the original and the converted font to stderr.
+
+  Build:
+    cc -o u8grlefont u8grlefont.c
+
+  Universal 8bit Graphics Library
+
+  Copyright (c) 2011, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define FONT_DATA_STRUCT_SIZE 17
+#define FONT_MAX 0x10000
+
+unsigned char font_in[FONT_MAX];
+unsigned char font_out[FONT_MAX];
+long font_in_len;
+long font_out_len;
+
+/*========================================================================*/
+/* read the input file */
+
+char *read_file(const char *name)
+{
+  FILE *fp;
+  char *buf;
+  long len;
+
+  fp = fopen(name, "rb");
+  if ( fp == NULL )
+  {
+    perror(name);
+    return NULL;
+  }
+  fseek(fp, 0, SEEK_END);
+  len = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  buf = malloc(len+1);
+  if ( buf == NULL )
+  {
+    fclose(fp);
+    return NULL;
+  }
+  len = fread(buf, 1, len, fp);
+  buf[len] = '\0';
+  fclose(fp);
+  return buf;
+}
+
+/*
+  find the next font definition "const u8g_fntpgm_uint8_t <name>[...] ... = { ... };"
+  copy the name and the bytes into font_in, return pointer behind the definition
+*/
+char *parse_font(char *s, char *name, int name_size)
+{
+  char *p;
+  int i;
+
+  for(;;)
+  {
+    s = strstr(s, "u8g_fntpgm_uint8_t");
+    if ( s == NULL )
+      return NULL;
+    s += strlen("u8g_fntpgm_uint8_t");
+    while( isspace((unsigned char)*s) )
+      s++;
+    i = 0;
+    while( isalnum((unsigned char)*s) || *s == '_' )
+    {
+      if ( i < name_size-1 )
+        name[i++] = *s;
+      s++;
+    }
+    name[i] = '\0';
+    p = s;
+    while( *p != '\0' && *p != ';' && *p != '=' )
+      p++;
+    if ( *p == '=' )
+      break;		/* definition, not a declaration */
+    s = p;
+  }
+
+  s = strchr(s, '{');
+  if ( s == NULL )
+    return NULL;
+  s++;
+  font_in_len = 0;
+  for(;;)
+  {
+    while( isspace((unsigned char)*s) || *s == ',' )
+      s++;
+    if ( *s == '}' || *s == '\0' )
+      break;
+    if ( font_in_len >= FONT_MAX )
+      return NULL;
+    font_in[font_in_len++] = (unsigned char)strtol(s, &p, 0);
+    if ( p == s )
+      return NULL;
+    s = p;
+  }
+  return s;
+}
+
+/*========================================================================*/
+/* run length encoding */
+
+unsigned char glyph_bits[255*255];	/* one byte per pixel */
+unsigned char rle_buf[256];
+int rle_len;
+int rle_bit_pos;
+
+void rle_put(int val, int cnt)
+{
+  int i;
+  for( i = 0; i < cnt; i++ )
+  {
+    if ( rle_bit_pos == 0 )
+      rle_buf[rle_len++] = 0;
+    if ( val & (1 << i) )
+      rle_buf[rle_len-1] |= 1 << rle_bit_pos;
+    rle_bit_pos = (rle_bit_pos + 1) & 7;
+  }
+}
+
+/* 
+  encode the glyph bitmap with the given number of bits for 0 and 1 runs, 
+  returns the number of bytes or 256 if the result does not fit 
+*/
+int rle_encode(int n, int bits0, int bits1, int is_repeat)
+{
+  int max0 = (1 << bits0) - 1;
+  int max1 = (1 << bits1) - 1;
+  int pos = 0, len0, len1;
+  int prev0 = -1, prev1 = -1;
+
+  rle_len = 0;
+  rle_bit_pos = 0;
+
+  /* trailing 0 pixel are not stored */
+  while( n > 0 && glyph_bits[n-1] == 0 )
+    n--;
+
+  while( pos < n )
+  {
+    len0 = 0;
+    while( pos < n && glyph_bits[pos] == 0 && len0 < max0 )
+      pos++, len0++;
+    len1 = 0;
+    if ( pos >= n || glyph_bits[pos] != 0 || len0 < max0 )
+      while( pos < n && glyph_bits[pos] != 0 && len1 < max1 )
+        pos++, len1++;
+
+    if ( is_repeat && len0 == prev0 && len1 == prev1 )
+    {
+      rle_put(1, 1);
+    }
+    else
+    {
+      if ( is_repeat && prev0 >= 0 )
+        rle_put(0, 1);
+      rle_put(len0, bits0);
+      rle_put(len1, bits1);
+      prev0 = len0;
+      prev1 = len1;
+    }
+    if ( rle_len > 255 )
+      return 256;
+  }
+  /* the last repeat flag can be omitted: the decoder stops at the end of the data */
+  return rle_len;
+}
+
+/*========================================================================*/
+/* conversion */
+
+/* convert with the given run length encoding (byte 17), returns the size of the font or 0 */
+long convert_font_rle(const char *name, int rle, int is_msg)
+{
+  unsigned char *in = font_in + FONT_DATA_STRUCT_SIZE;
+  unsigned char *out = font_out + FONT_DATA_STRUCT_SIZE + 1;
+  int format = font_in[0];
+  int start = font_in[10];
+  int end = font_in[11];
+  int enc;
+  int w, h, size, dx, x, y;
+  int bytes_per_line;
+  int i, j;
+  long pos;
+
+  memcpy(font_out, font_in, FONT_DATA_STRUCT_SIZE);
+  font_out[0] = 4;
+  font_out[6] = font_out[7] = 0;
+  font_out[8] = font_out[9] = 0;
+  font_out[FONT_DATA_STRUCT_SIZE] = rle;
+
+  for( enc = start; enc <= end; enc++ )
+  {
+    pos = out - font_out;
+    if ( enc == 65 || enc == 97 )
+    {
+      font_out[enc == 65 ? 6 : 8] = pos >> 8;
+      font_out[enc == 65 ? 7 : 9] = pos & 255;
+    }
+
+    if ( in >= font_in + font_in_len )
+    {
+      if ( is_msg )
+        fprintf(stderr, "%s: unexpected end of font data\n", name);
+      return 0;
+    }
+    if ( *in == 255 )
+    {
+      *out++ = 255;
+      in++;
+      continue;
+    }
+
+    if ( format == 1 )
+    {
+      x = in[0] >> 4;
+      y = (in[0] & 15) - 2;
+      w = in[1] >> 4;
+      h = in[1] & 15;
+      size = in[2] & 15;
+      dx = in[2] >> 4;
+      in += 3;
+    }
+    else
+    {
+      w = in[0];
+      h = in[1];
+      size = in[2];
+      dx = (signed char)in[3];
+      x = (signed char)in[4];
+      y = (signed char)in[5];
+      in += 6;
+    }
+
+    bytes_per_line = (w + 7) / 8;
+    if ( bytes_per_line * h != size )
+    {
+      if ( is_msg )
+        fprintf(stderr, "%s: glyph %d has an unexpected data size\n", name, enc);
+      return 0;
+    }
+
+    for( j = 0; j < h; j++ )
+      for( i = 0; i < w; i++ )
+        glyph_bits[j*w + i] = in[j*bytes_per_line + i/8] & (128 >> (i&7));
+
+    if ( rle_encode(w * h, rle & 7, (rle >> 3) & 7, rle >> 6) > 255 )
+    {
+      if ( is_msg )
+        fprintf(stderr, "%s: glyph %d is too large for format 4\n", name, enc);
+      return 0;
+    }
+    if ( out + 6 + rle_len >= font_out + FONT_MAX )
+      return 0;
+
+    out[0] = w;
+    out[1] = h;
+    out[2] = rle_len;
+    out[3] = dx;
+    out[4] = x;
+    out[5] = y;
+    out += 6;
+    memcpy(out, rle_buf, rle_len);
+    out += rle_len;
+    in += size;
+  }
+
+  font_out_len = out - font_out;
+  return font_out_len;
+}
+
+/* try all run length encodings and keep the smallest font in font_out */
+int convert_font(const char *name)
+{
+  int bits0, bits1, is_repeat;
+  int rle, best = -1;
+  long len, best_len = FONT_MAX;
+
+  if ( font_in[0] > 2 )
+  {
+    fprintf(stderr, "%s: font format %d can not be converted\n", name, font_in[0]);
+    return 0;
+  }
+
+  for( is_repeat = 0; is_repeat < 2; is_repeat++ )
+    for( bits0 = 1; bits0 <= 7; bits0++ )
+      for( bits1 = 1; bits1 <= 7; bits1++ )
+      {
+        rle = bits0 | (bits1 << 3) | (is_repeat << 6);
+        len = convert_font_rle(name, rle, 0);
+        if ( len > 0 && len < best_len )
+        {
+          best_len = len;
+          best = rle;
+        }
+      }
+  if ( best < 0 )
+  {
+    /* repeat the conversion to show the problem */
+    convert_font_rle(name, 7 | (7 << 3), 1);
+    return 0;
+  }
+  return convert_font_rle(name, best, 1) > 0;
+}
+
+void write_font(FILE *fp, const char *name)
+{
+  long i;
+  fprintf(fp, "const u8g_fntpgm_uint8_t %sz[%ld] U8G_FONT_SECTION(\"%sz\") = {", name, font_out_len, name);
+  for( i = 0; i < font_out_len; i++ )
+  {
+    if ( (i % 16) == 0 )
+      fprintf(fp, "\n  ");
+    fprintf(fp, "%d", font_out[i]);
+    if ( i+1 < font_out_len )
+      fprintf(fp, ",");
+  }
+  fprintf(fp, "};\n");
+}
+
+int main(int argc, char **argv)
+{
+  char name[256];
+  char *buf, *s;
+  FILE *fp = stdout;
+  int cnt = 0;
+  int is_verbose = 0;
+
+  if ( argc > 1 && strcmp(argv[1], "-v") == 0 )
+  {
+    is_verbose = 1;
+    argc--;
+    argv++;
+  }
+  if ( argc < 2 )
+  {
+    fprintf(stderr, "usage: %s [-v] <u8g font c file> [<output c file>]\n", argv[0]);
+    return 1;
+  }
+  buf = read_file(argv[1]);
+  if ( buf == NULL )
+    return 1;
+  if ( argc > 2 )
+  {
+    fp = fopen(argv[2], "w");
+    if ( fp == NULL )
+    {
+      perror(argv[2]);
+      return 1;
+    }
+  }
+
+  fprintf(fp, "#include \"u8g.h\"\n");
+  fprintf(fp, "#ifndef U8G_WITH_RLE_FONT\n");
+  fprintf(fp, "#error \"format 4 font requires U8G_WITH_RLE_FONT in u8g.h\"\n");
+  fprintf(fp, "#endif\n");
+  s = buf;
+  while( (s = parse_font(s, name, sizeof(name))) != NULL )
+  {
+    if ( convert_font(name) == 0 )
+      return 1;
+    write_font(fp, name);
+    if ( is_verbose )
+      fprintf(stderr, "%s: %ld --> %ld bytes (%ld%%)\n", name, font_in_len, font_out_len, 
+        (font_out_len * 100 + font_in_len/2) / font_in_len);
+    cnt++;
+  }
+
+  if ( fp != stdout )
+    fclose(fp);
+  if ( cnt == 0 )
+  {
+    fprintf(stderr, "%s: no font found\n", argv[1]);
+    return 1;
+  }
+  return 0;
+}
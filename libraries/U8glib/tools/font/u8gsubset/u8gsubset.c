@@ -0,0 +1,453 @@
+/*
+
+  u8gsubset.c
+
+  Create a font which only contains the glyphs used by an application.
+
+  The encodings of the glyphs are not changed, so strings and numbers are
+  drawn as before. The encoding range of the new font is reduced to the
+  first and the last used character, all unused glyphs inside this range
+  are replaced by an empty glyph (one byte). This also shortens the walk
+  of u8g_GetGlyph() through the font. All font formats (0 to 4) are
+  supported.
+
+  Usage:
+    u8gsubset [options] <u8g font c file> <font name> [<output c file>]
+
+  Options:
+    -s <string>   add all characters of the string
+    -c <chars>    add characters, ranges like "0-9" or "A-Z" are allowed
+    -f <file>     add all characters of the string and character literals
+                  of a C/C++ source file (e.g. the .ino file of the sketch)
+    -n <name>     name of the new font, default is the font name with
+                  suffix "_sub", e.g. u8g_font_6x10 --> u8g_font_6x10_sub
+    -v            print the size of the original and the new font to stderr
+
+  Numbers which are printed at runtime (u8g.print(int)) are not found in the
+  source code: add them with -c "0-9" (and "-" for negative values). Note
+  that the space is a glyph, too: without it, words are not separated.
+
+  Example:
+    u8gsubset -c " 0-9/o-" u8g_font_data.c u8g_font_9x15 font_9x15.c
+
+  Build:
+    cc -o u8gsubset u8gsubset.c
+
+  Universal 8bit Graphics Library
+
+  Copyright (c) 2011, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define FONT_DATA_STRUCT_SIZE 17
+#define FONT_MAX 0x10000
+
+unsigned char font_in[FONT_MAX];
+unsigned char font_out[FONT_MAX];
+long font_in_len;
+long font_out_len;
+
+/*========================================================================*/
+/* read the input file */
+
+char *read_file(const char *name)
+{
+  FILE *fp;
+  char *buf;
+  long len;
+
+  fp = fopen(name, "rb");
+  if ( fp == NULL )
+  {
+    perror(name);
+    return NULL;
+  }
+  fseek(fp, 0, SEEK_END);
+  len = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  buf = malloc(len+1);
+  if ( buf == NULL )
+  {
+    fclose(fp);
+    return NULL;
+  }
+  len = fread(buf, 1, len, fp);
+  buf[len] = '\0';
+  fclose(fp);
+  return buf;
+}
+
+/*
+  find the next font definition "const u8g_fntpgm_uint8_t <name>[...] ... = { ... };"
+  copy the name and the bytes into font_in, return pointer behind the definition
+*/
+char *parse_font(char *s, char *name, int name_size)
+{
+  char *p;
+  int i;
+
+  for(;;)
+  {
+    s = strstr(s, "u8g_fntpgm_uint8_t");
+    if ( s == NULL )
+      return NULL;
+    s += strlen("u8g_fntpgm_uint8_t");
+    while( isspace((unsigned char)*s) )
+      s++;
+    i = 0;
+    while( isalnum((unsigned char)*s) || *s == '_' )
+    {
+      if ( i < name_size-1 )
+        name[i++] = *s;
+      s++;
+    }
+    name[i] = '\0';
+    p = s;
+    while( *p != '\0' && *p != ';' && *p != '=' )
+      p++;
+    if ( *p == '=' )
+      break;		/* definition, not a declaration */
+    s = p;
+  }
+
+  s = strchr(s, '{');
+  if ( s == NULL )
+    return NULL;
+  s++;
+  font_in_len = 0;
+  for(;;)
+  {
+    while( isspace((unsigned char)*s) || *s == ',' )
+      s++;
+    if ( *s == '}' || *s == '\0' )
+      break;
+    if ( font_in_len >= FONT_MAX )
+      return NULL;
+    font_in[font_in_len++] = (unsigned char)strtol(s, &p, 0);
+    if ( p == s )
+      return NULL;
+    s = p;
+  }
+  return s;
+}
+
+/*========================================================================*/
+/* characters of the application */
+
+unsigned char is_used[256];
+
+void add_string(const char *s)
+{
+  while( *s != '\0' )
+    is_used[(unsigned char)*s++] = 1;
+}
+
+void add_chars(const char *s)
+{
+  int i;
+  while( *s != '\0' )
+  {
+    if ( s[1] == '-' && s[2] != '\0' )
+    {
+      for( i = (unsigned char)s[0]; i <= (unsigned char)s[2]; i++ )
+        is_used[i] = 1;
+      s += 3;
+    }
+    else
+    {
+      is_used[(unsigned char)*s++] = 1;
+    }
+  }
+}
+
+/* one character of a string or character literal, returns pointer behind it */
+char *add_literal_char(char *s)
+{
+  int c;
+  if ( *s != '\\' )
+  {
+    is_used[(unsigned char)*s] = 1;
+    return s+1;
+  }
+  s++;
+  switch( *s )
+  {
+    case 'n': case 'r': case 't': case '0':
+      return s+1;	/* control characters are never drawn */
+    case 'x':
+      c = strtol(s+1, &s, 16);
+      is_used[c & 255] = 1;
+      return s;
+    case '\0':
+      return s;
+  }
+  is_used[(unsigned char)*s] = 1;
+  return s+1;
+}
+
+int add_file(const char *name)
+{
+  char *buf, *s;
+  char quote;
+
+  buf = read_file(name);
+  if ( buf == NULL )
+    return 0;
+  s = buf;
+  while( *s != '\0' )
+  {
+    if ( s[0] == '/' && s[1] == '/' )
+    {
+      while( *s != '\0' && *s != '\n' )
+        s++;
+    }
+    else if ( s[0] == '/' && s[1] == '*' )
+    {
+      s += 2;
+      while( *s != '\0' && !(s[0] == '*' && s[1] == '/') )
+        s++;
+      if ( *s != '\0' )
+        s += 2;
+    }
+    else if ( *s == '"' || *s == '\'' )
+    {
+      quote = *s++;
+      while( *s != '\0' && *s != quote && *s != '\n' )
+        s = add_literal_char(s);
+      if ( *s == quote )
+        s++;
+    }
+    else
+    {
+      s++;
+    }
+  }
+  free(buf);
+  return 1;
+}
+
+/*========================================================================*/
+/* subset */
+
+int subset_font(const char *name)
+{
+  int format = font_in[0];
+  int data_struct_size = format == 4 ? FONT_DATA_STRUCT_SIZE+1 : FONT_DATA_STRUCT_SIZE;
+  int glyph_struct_size = format == 1 ? 3 : 6;
+  int size_mask = format == 1 ? 15 : 255;
+  int start = font_in[10];
+  int end = font_in[11];
+  int new_start, new_end;
+  int enc, len;
+  unsigned char *in = font_in + data_struct_size;
+  unsigned char *out = font_out + data_struct_size;
+  long pos;
+
+  if ( format > 4 )
+  {
+    fprintf(stderr, "%s: unknown font format %d\n", name, format);
+    return 0;
+  }
+
+  new_start = 256;
+  new_end = -1;
+  for( enc = start; enc <= end; enc++ )
+    if ( is_used[enc] )
+    {
+      if ( new_start > enc )
+        new_start = enc;
+      new_end = enc;
+    }
+  if ( new_end < 0 )
+  {
+    fprintf(stderr, "%s: none of the characters is part of the font\n", name);
+    return 0;
+  }
+
+  memcpy(font_out, font_in, data_struct_size);
+  font_out[6] = font_out[7] = 0;
+  font_out[8] = font_out[9] = 0;
+  font_out[10] = new_start;
+  font_out[11] = new_end;
+
+  for( enc = start; enc <= new_end; enc++ )
+  {
+    if ( in >= font_in + font_in_len )
+    {
+      fprintf(stderr, "%s: unexpected end of font data\n", name);
+      return 0;
+    }
+    if ( *in == 255 )
+      len = 1;
+    else
+      len = glyph_struct_size + (in[2] & size_mask);
+
+    if ( enc >= new_start )
+    {
+      pos = out - font_out;
+      if ( enc == 65 || enc == 97 )
+      {
+        font_out[enc == 65 ? 6 : 8] = pos >> 8;
+        font_out[enc == 65 ? 7 : 9] = pos & 255;
+      }
+      if ( is_used[enc] )
+      {
+        memcpy(out, in, len);
+        out += len;
+      }
+      else
+      {
+        *out++ = 255;
+      }
+    }
+    in += len;
+  }
+
+  font_out_len = out - font_out;
+  return 1;
+}
+
+void write_font(FILE *fp, const char *name)
+{
+  long i;
+  fprintf(fp, "const u8g_fntpgm_uint8_t %s[%ld] U8G_FONT_SECTION(\"%s\") = {", name, font_out_len, name);
+  for( i = 0; i < font_out_len; i++ )
+  {
+    if ( (i % 16) == 0 )
+      fprintf(fp, "\n  ");
+    fprintf(fp, "%d", font_out[i]);
+    if ( i+1 < font_out_len )
+      fprintf(fp, ",");
+  }
+  fprintf(fp, "};\n");
+}
+
+void usage(const char *prg)
+{
+  fprintf(stderr, "usage: %s [-s <string>] [-c <chars>] [-f <file>] [-n <name>] [-v] <u8g font c file> <font name> [<output c file>]\n", prg);
+}
+
+int main(int argc, char **argv)
+{
+  char name[256];
+  char new_name[256];
+  const char *prg = argv[0];
+  char *buf, *s;
+  FILE *fp = stdout;
+  int is_verbose = 0;
+
+  new_name[0] = '\0';
+  argc--;
+  argv++;
+  while( argc > 0 && argv[0][0] == '-' )
+  {
+    if ( strcmp(argv[0], "-v") == 0 )
+    {
+      is_verbose = 1;
+      argc--;
+      argv++;
+      continue;
+    }
+    if ( argc < 2 )
+    {
+      usage(prg);
+      return 1;
+    }
+    if ( strcmp(argv[0], "-s") == 0 )
+      add_string(argv[1]);
+    else if ( strcmp(argv[0], "-c") == 0 )
+      add_chars(argv[1]);
+    else if ( strcmp(argv[0], "-f") == 0 )
+    {
+      if ( add_file(argv[1]) == 0 )
+        return 1;
+    }
+    else if ( strcmp(argv[0], "-n") == 0 )
+    {
+      strncpy(new_name, argv[1], sizeof(new_name)-1);
+      new_name[sizeof(new_name)-1] = '\0';
+    }
+    else
+    {
+      usage(prg);
+      return 1;
+    }
+    argc -= 2;
+    argv += 2;
+  }
+  if ( argc < 2 )
+  {
+    usage(prg);
+    return 1;
+  }
+
+  buf = read_file(argv[0]);
+  if ( buf == NULL )
+    return 1;
+  s = buf;
+  for(;;)
+  {
+    s = parse_font(s, name, sizeof(name));
+    if ( s == NULL )
+    {
+      fprintf(stderr, "%s: font %s not found\n", argv[0], argv[1]);
+      return 1;
+    }
+    if ( strcmp(name, argv[1]) == 0 )
+      break;
+  }
+  if ( new_name[0] == '\0' )
+    sprintf(new_name, "%.250s_sub", name);
+
+  if ( subset_font(name) == 0 )
+    return 1;
+
+  if ( argc > 2 )
+  {
+    fp = fopen(argv[2], "w");
+    if ( fp == NULL )
+    {
+      perror(argv[2]);
+      return 1;
+    }
+  }
+  fprintf(fp, "#include \"u8g.h\"\n");
+  write_font(fp, new_name);
+  if ( fp != stdout )
+    fclose(fp);
+
+  if ( is_verbose )
+    fprintf(stderr, "%s: %ld --> %ld bytes (%ld%%), encoding %d..%d --> %d..%d\n", name, font_in_len, font_out_len,
+      (font_out_len * 100 + font_in_len/2) / font_in_len, font_in[10], font_in[11], font_out[10], font_out[11]);
+  return 0;
+}
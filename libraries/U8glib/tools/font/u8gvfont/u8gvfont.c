@@ -0,0 +1,320 @@
+/*
+
+  u8gvfont.c
+
+  Convert u8g fonts (format 0, 1 or 2) into format 3 fonts.
+
+  Format 3 uses the glyph information of format 0, but the bitmap is stored
+  column by column: (BBX height + 7)/8 bytes per column, bit 0 of each byte
+  is the upper pixel. Page buffers with vertical byte orientation (pb8v1)
+  copy such a glyph with one shift and one OR per column.
+
+  Usage:
+    u8gvfont <u8g font c file> [<output c file>]
+
+  All fonts of the input file are converted. The name of the converted font
+  gets the suffix "v", e.g. u8g_font_6x10 --> u8g_font_6x10v.
+  Add "extern const u8g_fntpgm_uint8_t u8g_font_6x10v[];" to the sketch.
+
+  Build:
+    cc -o u8gvfont u8gvfont.c
+
+  Universal 8bit Graphics Library
+
+  Copyright (c) 2011, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define FONT_DATA_STRUCT_SIZE 17
+#define FONT_MAX 0x10000
+
+unsigned char font_in[FONT_MAX];
+unsigned char font_out[FONT_MAX];
+long font_in_len;
+long font_out_len;
+
+/*========================================================================*/
+/* read the input file */
+
+char *read_file(const char *name)
+{
+  FILE *fp;
+  char *buf;
+  long len;
+
+  fp = fopen(name, "rb");
+  if ( fp == NULL )
+  {
+    perror(name);
+    return NULL;
+  }
+  fseek(fp, 0, SEEK_END);
+  len = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  buf = malloc(len+1);
+  if ( buf == NULL )
+  {
+    fclose(fp);
+    return NULL;
+  }
+  len = fread(buf, 1, len, fp);
+  buf[len] = '\0';
+  fclose(fp);
+  return buf;
+}
+
+/*
+  find the next font definition "const u8g_fntpgm_uint8_t <name>[...] ... = { ... };"
+  copy the name and the bytes into font_in, return pointer behind the definition
+*/
+char *parse_font(char *s, char *name, int name_size)
+{
+  char *p;
+  int i;
+
+  for(;;)
+  {
+    s = strstr(s, "u8g_fntpgm_uint8_t");
+    if ( s == NULL )
+      return NULL;
+    s += strlen("u8g_fntpgm_uint8_t");
+    while( isspace((unsigned char)*s) )
+      s++;
+    i = 0;
+    while( isalnum((unsigned char)*s) || *s == '_' )
+    {
+      if ( i < name_size-1 )
+        name[i++] = *s;
+      s++;
+    }
+    name[i] = '\0';
+    p = s;
+    while( *p != '\0' && *p != ';' && *p != '=' )
+      p++;
+    if ( *p == '=' )
+      break;		/* definition, not a declaration */
+    s = p;
+  }
+
+  s = strchr(s, '{');
+  if ( s == NULL )
+    return NULL;
+  s++;
+  font_in_len = 0;
+  for(;;)
+  {
+    while( isspace((unsigned char)*s) || *s == ',' )
+      s++;
+    if ( *s == '}' || *s == '\0' )
+      break;
+    if ( font_in_len >= FONT_MAX )
+      return NULL;
+    font_in[font_in_len++] = (unsigned char)strtol(s, &p, 0);
+    if ( p == s )
+      return NULL;
+    s = p;
+  }
+  return s;
+}
+
+/*========================================================================*/
+/* conversion */
+
+int convert_font(const char *name)
+{
+  unsigned char *in = font_in + FONT_DATA_STRUCT_SIZE;
+  unsigned char *out = font_out + FONT_DATA_STRUCT_SIZE;
+  int format = font_in[0];
+  int start = font_in[10];
+  int end = font_in[11];
+  int enc;
+  int w, h, size, dx, x, y;
+  int bytes_per_line, bytes_per_col;
+  int i, j, k;
+  long pos;
+
+  if ( format > 2 )
+  {
+    fprintf(stderr, "%s: font format %d can not be converted\n", name, format);
+    return 0;
+  }
+
+  memcpy(font_out, font_in, FONT_DATA_STRUCT_SIZE);
+  font_out[0] = 3;
+  font_out[6] = font_out[7] = 0;
+  font_out[8] = font_out[9] = 0;
+
+  for( enc = start; enc <= end; enc++ )
+  {
+    pos = out - font_out;
+    if ( enc == 65 || enc == 97 )
+    {
+      font_out[enc == 65 ? 6 : 8] = pos >> 8;
+      font_out[enc == 65 ? 7 : 9] = pos & 255;
+    }
+
+    if ( in >= font_in + font_in_len )
+    {
+      fprintf(stderr, "%s: unexpected end of font data\n", name);
+      return 0;
+    }
+    if ( *in == 255 )
+    {
+      *out++ = 255;
+      in++;
+      continue;
+    }
+
+    if ( format == 1 )
+    {
+      x = in[0] >> 4;
+      y = (in[0] & 15) - 2;
+      w = in[1] >> 4;
+      h = in[1] & 15;
+      size = in[2] & 15;
+      dx = in[2] >> 4;
+      in += 3;
+    }
+    else
+    {
+      w = in[0];
+      h = in[1];
+      size = in[2];
+      dx = (signed char)in[3];
+      x = (signed char)in[4];
+      y = (signed char)in[5];
+      in += 6;
+    }
+
+    bytes_per_line = (w + 7) / 8;
+    bytes_per_col = (h + 7) / 8;
+    if ( bytes_per_line * h != size )
+    {
+      fprintf(stderr, "%s: glyph %d has an unexpected data size\n", name, enc);
+      return 0;
+    }
+    if ( w * bytes_per_col > 255 )
+    {
+      fprintf(stderr, "%s: glyph %d is too large for format 3\n", name, enc);
+      return 0;
+    }
+    if ( out + 6 + w * bytes_per_col >= font_out + FONT_MAX )
+      return 0;
+
+    out[0] = w;
+    out[1] = h;
+    out[2] = w * bytes_per_col;
+    out[3] = dx;
+    out[4] = x;
+    out[5] = y;
+    out += 6;
+
+    for( i = 0; i < w; i++ )
+    {
+      for( j = 0; j < bytes_per_col; j++ )
+      {
+        unsigned char b = 0;
+        for( k = 0; k < 8 && j*8+k < h; k++ )
+        {
+          if ( in[(j*8+k)*bytes_per_line + i/8] & (128 >> (i&7)) )
+            b |= 1 << k;
+        }
+        *out++ = b;
+      }
+    }
+    in += size;
+  }
+
+  font_out_len = out - font_out;
+  return 1;
+}
+
+void write_font(FILE *fp, const char *name)
+{
+  long i;
+  fprintf(fp, "const u8g_fntpgm_uint8_t %sv[%ld] U8G_FONT_SECTION(\"%sv\") = {", name, font_out_len, name);
+  for( i = 0; i < font_out_len; i++ )
+  {
+    if ( (i % 16) == 0 )
+      fprintf(fp, "\n  ");
+    fprintf(fp, "%d", font_out[i]);
+    if ( i+1 < font_out_len )
+      fprintf(fp, ",");
+  }
+  fprintf(fp, "};\n");
+}
+
+int main(int argc, char **argv)
+{
+  char name[256];
+  char *buf, *s;
+  FILE *fp = stdout;
+  int cnt = 0;
+
+  if ( argc < 2 )
+  {
+    fprintf(stderr, "usage: %s <u8g font c file> [<output c file>]\n", argv[0]);
+    return 1;
+  }
+  buf = read_file(argv[1]);
+  if ( buf == NULL )
+    return 1;
+  if ( argc > 2 )
+  {
+    fp = fopen(argv[2], "w");
+    if ( fp == NULL )
+    {
+      perror(argv[2]);
+      return 1;
+    }
+  }
+
+  fprintf(fp, "#include \"u8g.h\"\n");
+  s = buf;
+  while( (s = parse_font(s, name, sizeof(name))) != NULL )
+  {
+    if ( convert_font(name) == 0 )
+      return 1;
+    write_font(fp, name);
+    cnt++;
+  }
+
+  if ( fp != stdout )
+    fclose(fp);
+  if ( cnt == 0 )
+  {
+    fprintf(stderr, "%s: no font found\n", argv[1]);
+    return 1;
+  }
+  return 0;
+}
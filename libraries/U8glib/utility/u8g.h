@@ -42,6 +42,22 @@
 /* comment the following line to generate more compact but interrupt unsafe code */
 #define U8G_INTERRUPT_SAFE 1
 
+/* 
+  uncomment the following line to draw run length encoded fonts (format 4, see tools/font/u8grlefont) 
+  the decoder adds about 1 KB of code and glyphs are drawn about 1.7 times slower: this pays off 
+  only if the converted fonts save more than about 2 KB (e.g. a 32 pixel DejaVu Sans font), 
+  for the 5x7 .. 9x15 fonts the code grows (Lightduino: 508 bytes saved, 1067 bytes decoder)
+*/
+//#define U8G_WITH_RLE_FONT 1
+
+/* uncomment the following line to send I2C pages from the TWI interrupt, see u8g_i2c_queue_init() (AVR only) */
+/* this defines ISR(TWI_vect): the Wire library can not be used together with this option */
+//#define U8G_WITH_I2C_QUEUE 1
+
+/* uncomment the following line if the SSD1306/SH1106 128x64 OLED is mounted upside down: */
+/* the controller mirrors columns and rows, u8g_SetRot180() is not required */
+//#define U8G_SSD13XX_ROT180 1
+
 
 #include <stddef.h>
 
@@ -164,6 +180,12 @@ typedef struct _u8g_dev_arg_pixel_t u8g_dev_arg_pixel_t;
 typedef struct _u8g_dev_arg_bbx_t u8g_dev_arg_bbx_t;
 typedef struct _u8g_box_t u8g_box_t;
 typedef struct _u8g_dev_arg_irgb_t u8g_dev_arg_irgb_t;
+typedef struct _u8g_dev_arg_vglyph_t u8g_dev_arg_vglyph_t;
+typedef struct _u8g_dev_arg_box_t u8g_dev_arg_box_t;
+typedef struct _u8g_pb64v1_t u8g_pb64v1_t;
+typedef struct _u8g_dl_t u8g_dl_t;
+typedef struct _u8g_font_index_t u8g_font_index_t;
+typedef struct _u8g_sc_t u8g_sc_t;
 
 
 /*===============================================================*/
@@ -236,6 +258,11 @@ extern u8g_dev_t u8g_dev_pbm_8h2;	/* grayscale simulation */
 /* Size: 128x64 monochrom, no output, used for performance measure */
 extern u8g_dev_t u8g_dev_gprof;
 
+/* Size: 128x64, in-memory image for host builds (not Arduino), see u8g_dev_mem_xxx() */
+extern u8g_dev_t u8g_dev_mem_128x64;		/* monochrom */
+extern u8g_dev_t u8g_dev_mem_128x64_gr;	/* 2 bit gray */
+extern u8g_dev_t u8g_dev_mem_128x64_332;	/* 8 bit, R3G3B2 */
+
 /* Display: EA DOGS102, Size: 102x64 monochrom */
 extern u8g_dev_t u8g_dev_uc1701_dogs102_sw_spi;
 extern u8g_dev_t u8g_dev_uc1701_dogs102_hw_spi;
@@ -443,6 +470,12 @@ extern u8g_dev_t u8g_dev_ssd1306_128x64_2x_sw_spi;
 extern u8g_dev_t u8g_dev_ssd1306_128x64_2x_hw_spi;
 extern u8g_dev_t u8g_dev_ssd1306_128x64_2x_i2c;
 
+/* full frame buffer (1024 bytes), only changed pages are transfered */
+extern u8g_dev_t u8g_dev_ssd1306_128x64_fb_sw_spi;
+extern u8g_dev_t u8g_dev_ssd1306_128x64_fb_hw_spi;
+extern u8g_dev_t u8g_dev_ssd1306_128x64_fb_i2c;
+extern u8g_pb64v1_t u8g_dev_ssd1306_128x64_fb_pb;
+
 /* OLED 128x64 Display with SH1106 Controller */
 extern u8g_dev_t u8g_dev_sh1106_128x64_sw_spi;
 extern u8g_dev_t u8g_dev_sh1106_128x64_hw_spi;
@@ -452,6 +485,11 @@ extern u8g_dev_t u8g_dev_sh1106_128x64_2x_sw_spi;
 extern u8g_dev_t u8g_dev_sh1106_128x64_2x_hw_spi;
 extern u8g_dev_t u8g_dev_sh1106_128x64_2x_i2c;
 
+extern u8g_dev_t u8g_dev_sh1106_128x64_fb_sw_spi;
+extern u8g_dev_t u8g_dev_sh1106_128x64_fb_hw_spi;
+extern u8g_dev_t u8g_dev_sh1106_128x64_fb_i2c;
+extern u8g_pb64v1_t u8g_dev_sh1106_128x64_fb_pb;
+
 /* OLED 128x64 Display with SSD1309 Controller */
 extern u8g_dev_t u8g_dev_ssd1309_128x64_sw_spi;
 extern u8g_dev_t u8g_dev_ssd1309_128x64_hw_spi;
@@ -570,6 +608,25 @@ struct _u8g_dev_arg_irgb_t
 };
 /* typedef struct _u8g_dev_arg_irgb_t u8g_dev_arg_irgb_t; */ /* forward decl */
 
+/* glyph of a font with format 3: column major, (h+7)/8 bytes per column, bit 0 is the upper pixel */
+struct _u8g_dev_arg_vglyph_t
+{
+  u8g_uint_t x, y;		/* upper left corner */
+  uint8_t w, h;
+  const u8g_pgm_uint8_t *data;
+  uint8_t color;
+  uint8_t is_done;		/* set by the device, if the glyph has been written to the buffer */
+};
+/* typedef struct _u8g_dev_arg_vglyph_t u8g_dev_arg_vglyph_t; */ /* forward decl */
+
+struct _u8g_dev_arg_box_t
+{
+  u8g_uint_t x, y, w, h;	/* will be modified */
+  uint8_t color;
+  uint8_t is_done;		/* set by the device, if the box has been written to the buffer */
+};
+/* typedef struct _u8g_dev_arg_box_t u8g_dev_arg_box_t; */ /* forward decl */
+
 
 
 #define U8G_DEV_MSG_INIT                10
@@ -603,6 +660,11 @@ struct _u8g_dev_arg_irgb_t
 #define U8G_DEV_MSG_SET_PIXEL                           50
 #define U8G_DEV_MSG_SET_8PIXEL                          59
 
+/* arg: u8g_dev_arg_vglyph_t *, devices which do not know this message leave is_done at 0 */
+#define U8G_DEV_MSG_SET_VGLYPH                          58
+/* arg: u8g_dev_arg_box_t *, filled box, devices which do not know this message leave is_done at 0 */
+#define U8G_DEV_MSG_SET_BOX                          57
+
 #define U8G_DEV_MSG_SET_COLOR_ENTRY                60
 
 #define U8G_DEV_MSG_SET_XY_CB                           61
@@ -948,6 +1010,15 @@ struct _u8g_pb_t
 };
 typedef struct _u8g_pb_t u8g_pb_t;
 
+/* checksums of the pages sent by the last picture loop, used to skip the transfer of unchanged pages */
+#define U8G_PB_SUM_PAGES 8
+struct _u8g_pb_sum_t
+{
+  uint8_t valid;		/* one bit for each page with a valid checksum */
+  uint16_t sum[U8G_PB_SUM_PAGES];
+};
+typedef struct _u8g_pb_sum_t u8g_pb_sum_t;
+
 
 /* u8g_pb.c */
 void u8g_pb_Clear(u8g_pb_t *b);
@@ -956,7 +1027,12 @@ uint8_t u8g_pb_IsXIntersection(u8g_pb_t *b, u8g_uint_t v0, u8g_uint_t v1);
 uint8_t u8g_pb_IsIntersection(u8g_pb_t *pb, u8g_dev_arg_bbx_t *bbx);
 void u8g_pb_GetPageBox(u8g_pb_t *pb, u8g_box_t *box);
 uint8_t u8g_pb_Is8PixelVisible(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel);
+void u8g_pb_SetBoxV1(u8g_pb_t *b, u8g_dev_arg_box_t *arg);
+void u8g_pb_SetBoxH1(u8g_pb_t *b, u8g_dev_arg_box_t *arg);
 uint8_t u8g_pb_WriteBuffer(u8g_pb_t *b, u8g_t *u8g, u8g_dev_t *dev);
+void u8g_pb_ResetSum(u8g_pb_sum_t *sum);
+uint8_t u8g_pb_IsChanged(u8g_pb_sum_t *sum, uint8_t page, uint8_t cnt, const uint8_t *buf);
+void u8g_pb_SetSumValid(u8g_pb_sum_t *sum, uint8_t page);
 
 /*
   note on __attribute__ ((nocommon))
@@ -983,12 +1059,24 @@ void u8g_pb8v1_Clear(u8g_pb_t *b) U8G_NOINLINE;
 uint8_t u8g_pb8v1_IsYIntersection(u8g_pb_t *b, u8g_uint_t v0, u8g_uint_t v1);
 uint8_t u8g_pb8v1_IsXIntersection(u8g_pb_t *b, u8g_uint_t v0, u8g_uint_t v1);
 uint8_t u8g_pb8v1_WriteBuffer(u8g_pb_t *b, u8g_t *u8g, u8g_dev_t *dev);
+void u8g_pb8v1_SetVGlyph(u8g_pb_t *b, u8g_dev_arg_vglyph_t *arg);
 
 uint8_t u8g_dev_pb8v1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
 /* u8g_pb16v1.c */
 uint8_t u8g_dev_pb16v1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
+/* u8g_pb64v1.c: full frame buffer, kept between picture loops */
+struct _u8g_pb64v1_t
+{
+  u8g_pb_t pb;
+  uint8_t dirty;		/* one bit for each 8 pixel row which has been changed since the last transfer */
+  u8g_pb_sum_t sum;	/* checksums of the rows on the display, see u8g_pb_IsChanged() */
+};
+
+void u8g_pb64v1_Clear(u8g_pb64v1_t *b);
+uint8_t u8g_dev_pb64v1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+
 /* u8g_pb14v1.c */
 uint8_t u8g_dev_pb14v1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
@@ -1136,6 +1224,9 @@ struct _u8g_t
   
   u8g_box_t current_page;		/* current box of the visible page */
 
+  u8g_dl_t *dl;			/* display list, NULL if the draw code is executed for each page */
+  u8g_font_index_t *font_index;		/* list of glyph indices, searched for the current font */
+  u8g_sc_t *str_cache;			/* string size cache, NULL: always measure */
 };
 
 #define u8g_GetFontAscent(u8g) ((u8g)->font_ref_ascent)
@@ -1151,6 +1242,8 @@ uint8_t u8g_SetContrastLL(u8g_t *u8g, u8g_dev_t *dev, uint8_t contrast);
 void u8g_DrawPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y);
 void u8g_Draw8PixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel);
 void u8g_Draw4TPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel);
+uint8_t u8g_DrawBoxLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);	/* returns 0 if the device can not fill the box */
+uint8_t u8g_DrawVGlyphLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, uint8_t w, uint8_t h, const u8g_pgm_uint8_t *data);	/* returns 0 if the device can not draw the glyph */
 uint8_t u8g_IsBBXIntersectionLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);	/* obsolete */
 u8g_uint_t u8g_GetWidthLL(u8g_t *u8g, u8g_dev_t *dev);
 u8g_uint_t u8g_GetHeightLL(u8g_t *u8g, u8g_dev_t *dev);
@@ -1230,6 +1323,52 @@ void u8g_backup_spi(uint8_t msg);		/* backup SPI state controller */
 
 void u8g_SetHardwareBackup(u8g_t *u8g, u8g_state_cb backup_cb);
 
+/* u8g_dl.c */
+
+#define U8G_DL_STATE_OFF 0
+#define U8G_DL_STATE_REC 1
+#define U8G_DL_STATE_CANCEL 2
+
+#define U8G_DL_OP_COLOR 1
+#define U8G_DL_OP_FONT 2
+#define U8G_DL_OP_STR 3
+#define U8G_DL_OP_PIXEL 4
+#define U8G_DL_OP_HLINE 5
+#define U8G_DL_OP_VLINE 6
+#define U8G_DL_OP_LINE 7
+#define U8G_DL_OP_FRAME 8
+#define U8G_DL_OP_BOX 9
+#define U8G_DL_OP_XBMP 10
+#define U8G_DL_OP_BITMAPP 11
+#define U8G_DL_OP_ZBMP 12
+
+struct _u8g_dl_t
+{
+  uint8_t *buf;
+  uint16_t size;		/* size of buf */
+  uint16_t len;			/* number of recorded bytes */
+  uint16_t run;			/* position of the length byte of the last glyph run */
+  u8g_uint_t run_x;		/* glyph run: next x position and baseline */
+  u8g_uint_t run_y;
+  const u8g_pgm_uint8_t *font;	/* last recorded font and color (see u8g_dev_arg_pixel_t) */
+  uint8_t color;
+  uint8_t hi_color;
+  uint8_t blue;
+  uint8_t state;
+};
+
+#define u8g_dl_IsRec(u8g) ((u8g)->dl != NULL && (u8g)->dl->state == U8G_DL_STATE_REC)
+
+void u8g_dl_Init(u8g_dl_t *dl, uint8_t *buf, uint16_t size);
+void u8g_SetDisplayList(u8g_t *u8g, u8g_dl_t *dl);		/* NULL: execute the draw code for each page */
+void u8g_dl_Start(u8g_t *u8g);
+void u8g_dl_Cancel(u8g_t *u8g);
+uint8_t u8g_dl_Render(u8g_t *u8g);
+int8_t u8g_dl_RecGlyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding);
+u8g_uint_t u8g_dl_RecStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s, uint8_t is_pgm);
+void u8g_dl_RecBox(u8g_t *u8g, uint8_t op, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);
+void u8g_dl_RecBitmap(u8g_t *u8g, uint8_t op, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap);
+
 /* u8g_clip.c */
 
 uint8_t u8g_IsBBXIntersection(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);
@@ -1256,6 +1395,24 @@ uint8_t u8g_font_GetFontEndEncoding(const void *font) U8G_NOINLINE;
 
 void u8g_SetFont(u8g_t *u8g, const u8g_fntpgm_uint8_t *font);
 
+/* 
+  glyph index: RAM table with the offset of every (1<<shift)-th glyph of a font,
+  u8g_GetGlyph starts the search there instead of walking the font from the
+  beginning or from the 'A'/'a' positions. With cnt > end-start encoding, the
+  lookup is direct (shift == 0).
+*/
+struct _u8g_font_index_t
+{
+  const u8g_pgm_uint8_t *font;
+  u8g_font_index_t *next;
+  uint16_t *offset;		/* cnt entries, offset of the glyph relative to the font start */
+  uint8_t cnt;
+  uint8_t shift;
+};
+
+void u8g_font_index_Init(u8g_font_index_t *fi, const u8g_fntpgm_uint8_t *font, uint16_t *buf, uint8_t cnt);
+void u8g_AddFontIndex(u8g_t *u8g, u8g_font_index_t *fi);
+
 uint8_t u8g_GetFontBBXWidth(u8g_t *u8g);
 uint8_t u8g_GetFontBBXHeight(u8g_t *u8g);
 int8_t u8g_GetFontBBXOffX(u8g_t *u8g);
@@ -1311,6 +1468,34 @@ int8_t u8g_GetStrXP(u8g_t *u8g, const u8g_pgm_uint8_t *s);
 u8g_uint_t u8g_GetStrWidth(u8g_t *u8g, const char *s) U8G_NOINLINE;
 u8g_uint_t u8g_GetStrWidthP(u8g_t *u8g, const u8g_pgm_uint8_t *s);
 
+/* string size cache, used by u8g_GetStrWidth and u8g_GetStrSize if set */
+#ifndef U8G_SC_STR_LEN
+#define U8G_SC_STR_LEN 14	/* longer strings in RAM are not cached */
+#endif
+struct _u8g_sc_entry_t
+{
+  const u8g_pgm_uint8_t *font;
+  const void *s;		/* address of a PROGMEM string, NULL for strings in RAM */
+  uint8_t len;			/* length and copy (not terminated) of a string in RAM */
+  char str[U8G_SC_STR_LEN];
+  u8g_uint_t width;
+  int8_t ascent;
+  int8_t descent;
+};
+typedef struct _u8g_sc_entry_t u8g_sc_entry_t;
+
+struct _u8g_sc_t
+{
+  u8g_sc_entry_t *entry;	/* most recently used entry first */
+  uint8_t cnt;
+  uint8_t used;
+};
+
+void u8g_sc_Init(u8g_sc_t *sc, u8g_sc_entry_t *buf, uint8_t cnt);
+void u8g_SetStrCache(u8g_t *u8g, u8g_sc_t *sc);		/* NULL: no cache */
+u8g_uint_t u8g_GetStrSize(u8g_t *u8g, const char *s, int8_t *ascent, int8_t *descent);
+u8g_uint_t u8g_GetStrSizeP(u8g_t *u8g, const u8g_pgm_uint8_t *s, int8_t *ascent, int8_t *descent);
+
 u8g_uint_t u8g_DrawStrFontBBX(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, const char *s);
 
 void u8g_GetStrMinBox(u8g_t *u8g, const char *s, u8g_uint_t *x, u8g_uint_t *y, u8g_uint_t *width, u8g_uint_t *height);
@@ -1321,6 +1506,7 @@ u8g_uint_t u8g_DrawAAStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s);
 
 /* u8g_rect.c */
 
+void u8g_draw_hline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w) U8G_NOINLINE;
 void u8g_draw_box(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) U8G_NOINLINE; 
 
 void u8g_DrawHLine(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w) U8G_NOINLINE;
@@ -1340,6 +1526,7 @@ void u8g_DrawBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g
 
 void u8g_DrawXBM(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const uint8_t *bitmap);
 void u8g_DrawXBMP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap);
+void u8g_DrawZBMP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *bitmap);
 
 
 /* u8g_line.c */
@@ -1367,6 +1554,7 @@ void u8g_DrawEllipseRect(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t x1
 
 void u8g_draw_circle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option) U8G_NOINLINE;
 void u8g_draw_disc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option) U8G_NOINLINE;
+void u8g_draw_disc_span(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option) U8G_NOINLINE;
 
 void u8g_DrawCircle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option);
 void u8g_DrawDisc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option);
@@ -1420,9 +1608,12 @@ struct pg_edge_struct
   uint8_t curr_idx;
 };
 
-/* maximum number of points in the polygon */
+/* maximum number of points in the polygon of u8g_AddPolygonXY() */
 /* can be redefined, but highest possible value is 254 */
+/* u8g_DrawPolygonList() is not limited by this value */
+#ifndef PG_MAX_POINTS
 #define PG_MAX_POINTS 6
+#endif
 
 /* index numbers for the pge structures below */
 #define PG_LEFT 0
@@ -1431,7 +1622,8 @@ struct pg_edge_struct
 
 struct _pg_struct
 {
-  struct pg_point_struct list[PG_MAX_POINTS];
+  struct pg_point_struct points[PG_MAX_POINTS];	/* points of u8g_AddPolygonXY() */
+  const struct pg_point_struct *list;		/* points of the polygon which is drawn */
   uint8_t cnt;
   uint8_t is_min_y_not_flat;
   pg_word_t total_scan_line_cnt;
@@ -1441,12 +1633,22 @@ struct _pg_struct
 void pg_ClearPolygonXY(pg_struct *pg);
 void pg_AddPolygonXY(pg_struct *pg, u8g_t *u8g, int16_t x, int16_t y);
 void pg_DrawPolygon(pg_struct *pg, u8g_t *u8g);
+void pg_DrawPolygonList(pg_struct *pg, u8g_t *u8g, const struct pg_point_struct *list, uint8_t cnt);
 void u8g_ClearPolygonXY(void);
 void u8g_AddPolygonXY(u8g_t *u8g, int16_t x, int16_t y);
 void u8g_DrawPolygon(u8g_t *u8g);
+void u8g_DrawPolygonList(u8g_t *u8g, const struct pg_point_struct *list, uint8_t cnt);	/* convex, list in RAM, cnt <= 254 */
 void u8g_DrawTriangle(u8g_t *u8g, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 
 
+/*===============================================================*/
+/* u8g_dev_mem.c, host builds only */
+uint8_t *u8g_dev_mem_GetImage(u8g_dev_t *dev);		/* width*height color indices, row by row */
+uint8_t u8g_dev_mem_GetPixel(u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y);
+int u8g_dev_mem_Compare(u8g_dev_t *dev, u8g_dev_t *ref);		/* number of different pixels */
+uint8_t u8g_dev_mem_WriteFile(u8g_dev_t *dev, const char *name);	/* PBM, PGM or PPM, depends on the mode */
+int u8g_dev_mem_CompareFile(u8g_dev_t *dev, const char *name);	/* number of different pixels, -1: file error */
+
 /*===============================================================*/
 /* u8g_virtual_screen.c */
 void u8g_SetVirtualScreenDimension(u8g_t *vs_u8g, u8g_uint_t width, u8g_uint_t height);
@@ -1464,7 +1666,9 @@ void st_Step(uint8_t player_pos, uint8_t is_auto_fire, uint8_t is_fire);
 #define U8G_I2C_OPT_NO_ACK 2
 #define U8G_I2C_OPT_DEV_0 0
 #define U8G_I2C_OPT_DEV_1 4
-#define U8G_I2C_OPT_FAST 16
+#define U8G_I2C_OPT_FAST 16		/* 400KHz */
+#define U8G_I2C_OPT_FAST_PLUS 32	/* 1000KHz (AVR: 500KHz with 8MHz, Due: ca. 470KHz) */
+#define U8G_I2C_OPT_PROBE 64		/* SSD1306/SH1106: probe the bus speed during init, up to 1000KHz (400KHz with FAST) */
 
 /* retrun values from u8g_twi_get_error() */
 #define U8G_I2C_ERR_NONE 0x00
@@ -1481,6 +1685,19 @@ uint8_t u8g_i2c_start(uint8_t sla) U8G_NOINLINE;
 uint8_t u8g_i2c_send_byte(uint8_t data) U8G_NOINLINE;
 uint8_t u8g_i2c_send_mode(uint8_t mode) U8G_NOINLINE;
 void u8g_i2c_stop(void) U8G_NOINLINE;
+uint16_t u8g_i2c_set_speed(uint16_t khz);	/* returns the speed in KHz, which has been set, 0 if unknown */
+uint16_t u8g_i2c_get_speed(void);
+uint16_t u8g_i2c_probe_speed(uint8_t sla, const uint8_t *data, uint8_t cnt, uint16_t max_khz);
+
+/* interrupt driven transmit queue, AVR hardware TWI only, see u8g_com_i2c.c */
+void u8g_i2c_queue_init(uint8_t *buf, uint8_t size);	/* buf = NULL disables the queue, size >= 150 holds one SSD1306/SH1106 page */
+uint8_t u8g_i2c_queue_is_enabled(void);
+uint8_t u8g_i2c_queue_is_lost(void);	/* 1 if queued bytes have been removed after an error, cleared by the call */
+void u8g_i2c_queue_start(uint8_t sla);
+void u8g_i2c_queue_send_byte(uint8_t data);
+void u8g_i2c_queue_send_seq(uint8_t cnt, const uint8_t *ptr);
+void u8g_i2c_queue_stop(void);
+uint8_t u8g_i2c_queue_wait(void);
 
 
 /*===============================================================*/
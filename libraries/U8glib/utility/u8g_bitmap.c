@@ -74,6 +74,11 @@ void u8g_DrawHBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, co
 
 void u8g_DrawBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap)
 {
+  if ( u8g_dl_IsRec(u8g) )
+  {
+    u8g_dl_RecBitmap(u8g, U8G_DL_OP_BITMAPP, x, y, cnt, h, bitmap);
+    return;
+  }
   if ( u8g_IsBBXIntersection(u8g, x, y, cnt*8, h) == 0 )
     return;
   while( h > 0 )
@@ -165,6 +170,11 @@ void u8g_DrawXBMP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint
   b += 7;
   b >>= 3;
   
+  if ( u8g_dl_IsRec(u8g) )
+  {
+    u8g_dl_RecBitmap(u8g, U8G_DL_OP_XBMP, x, y, w, h, bitmap);
+    return;
+  }
   if ( u8g_IsBBXIntersection(u8g, x, y, w, h) == 0 )
     return;
   while( h > 0 )
@@ -175,3 +185,132 @@ void u8g_DrawXBMP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint
     h--;
   }
 }
+
+/*=========================================================================*/
+
+/*
+  Compressed bitmap, created by tools/bitmap/u8gzbmp.c from a XBM or PBM file
+
+  offset
+  0,1           width                                 high byte first, 1..255
+  2,3           height                                high byte first, 1..255
+  4             rows per block                        1..255
+  5             position of each block (2 bytes per block, high byte first),
+                relative to the start of the bitmap
+  ...           blocks
+
+  A block contains the packed pixel rows, (width+7)/8 bytes per row, the 
+  highest bit is the left pixel (same as u8g_DrawBitmapP). The bytes of a 
+  block are packed with control bytes:
+    0..127      the next 1..128 bytes are copied
+    128..191    the next byte is repeated 3..66 times
+    192..255    2..65 bytes are copied from the row above (same columns)
+  Each block starts with a control byte and does not refer to the row above 
+  in its first row, so that the decoder can start with the first block which
+  intersects the current page. Bytes which are 0 are skipped.
+  A bitmap with a size or block height outside of these limits is not drawn.
+*/
+
+#define U8G_ZBMP_MAX_BYTES_PER_ROW 32
+
+static uint16_t u8g_zbmp_get_uint(const u8g_pgm_uint8_t *p)
+{
+  uint16_t v;
+  v = u8g_pgm_read(p);
+  v <<= 8;
+  v |= u8g_pgm_read(p+1);
+  return v;
+}
+
+void u8g_DrawZBMP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *bitmap)
+{
+  uint8_t row_buf[U8G_ZBMP_MAX_BYTES_PER_ROW];	/* row above */
+  const u8g_pgm_uint8_t *p;
+  uint16_t w, h;
+  u8g_uint_t first, last, row, ix;
+  uint8_t b, col;
+  uint8_t c, d = 0, cnt;
+  
+  w = u8g_zbmp_get_uint(bitmap);
+  h = u8g_zbmp_get_uint(bitmap+2);
+  if ( w == 0 || w > 255 || h == 0 || h > 255 )
+    return;
+  b = (w+7) >> 3;
+  if ( b > U8G_ZBMP_MAX_BYTES_PER_ROW || u8g_pgm_read(bitmap+4) == 0 )
+    return;
+  
+  if ( u8g_dl_IsRec(u8g) )
+  {
+    u8g_dl_RecBitmap(u8g, U8G_DL_OP_ZBMP, x, y, w, h, bitmap);
+    return;
+  }
+  if ( u8g_IsBBXIntersection(u8g, x, y, w, h) == 0 )
+    return;
+  
+  /* rows of the bitmap which are inside the current page */
+  /* first is 0 if the bitmap starts inside the page: y0-y wraps around and */
+  /* can not be compared with h if h is close to the maximum of u8g_uint_t */
+  first = y;
+  first -= u8g->current_page.y0;
+  if ( first <= (u8g_uint_t)(u8g->current_page.y1 - u8g->current_page.y0) )
+    first = 0;
+  else
+  {
+    first = u8g->current_page.y0;
+    first -= y;
+  }
+  last = u8g->current_page.y1;
+  last -= y;
+  if ( last >= h )
+    last = h-1;
+  
+  /* start with the block, which contains the first row */
+  c = u8g_pgm_read(bitmap+4);
+  row = first / c;
+  p = bitmap + u8g_zbmp_get_uint(bitmap + 5 + 2*row);
+  row *= c;
+  
+  col = 0;
+  ix = x;
+  for(;;)
+  {
+    c = u8g_pgm_read(p);
+    p++;
+    if ( c < 128 )
+      cnt = c+1;
+    else if ( c < 192 )
+    {
+      cnt = c-125;
+      d = u8g_pgm_read(p);
+      p++;
+    }
+    else
+      cnt = c-190;
+    do
+    {
+      if ( c < 128 )
+      {
+        d = u8g_pgm_read(p);
+        p++;
+      }
+      else if ( c >= 192 )
+      {
+        d = row_buf[col];
+      }
+      row_buf[col] = d;
+      if ( d != 0 && row >= first )
+        u8g_Draw8Pixel(u8g, ix, y+row, 0, d);
+      ix += 8;
+      col++;
+      if ( col == b )
+      {
+        if ( row == last )
+          return;
+        row++;
+        col = 0;
+        ix = x;
+      }
+      cnt--;
+    } while( cnt != 0 );
+  }
+}
@@ -290,37 +290,65 @@ void u8g_DrawCircle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, ui
   u8g_draw_circle(u8g, x0, y0, rad, option);
 }
 
-static void u8g_draw_disc_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option) U8G_NOINLINE;
+static void u8g_draw_disc_hline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
+{
+  if ( u8g_dl_IsRec(u8g) )
+    u8g_DrawHLine(u8g, x, y, w);
+  else
+    u8g_draw_hline(u8g, x, y, w);
+}
 
-static void u8g_draw_disc_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option)
+/*
+  filled quadrants are drawn with horizontal spans: row y0-y (upper) and
+  y0+y (lower) from x0-x (left) to x0+x (right). Only the rows of the
+  current page are sent to the device.
+*/
+void u8g_draw_disc_span(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option)
 {
-    /* upper right */
-    if ( option & U8G_DRAW_UPPER_RIGHT )
-    {
-      u8g_DrawVLine(u8g, x0+x, y0-y, y+1);
-      u8g_DrawVLine(u8g, x0+y, y0-x, x+1);
-    }
-    
-    /* upper left */
-    if ( option & U8G_DRAW_UPPER_LEFT )
-    {
-      u8g_DrawVLine(u8g, x0-x, y0-y, y+1);
-      u8g_DrawVLine(u8g, x0-y, y0-x, x+1);
-    }
-    
-    /* lower right */
+  u8g_uint_t xl, w;
+  
+  /* upper and lower half share the center row */
+  if ( y == 0 )
+  {
+    if ( option & U8G_DRAW_LOWER_LEFT )
+      option |= U8G_DRAW_UPPER_LEFT;
     if ( option & U8G_DRAW_LOWER_RIGHT )
+      option |= U8G_DRAW_UPPER_RIGHT;
+  }
+  
+  /* upper half */
+  if ( option & (U8G_DRAW_UPPER_LEFT|U8G_DRAW_UPPER_RIGHT) )
+  {
+    xl = x0;
+    w = 1;
+    if ( option & U8G_DRAW_UPPER_LEFT )
     {
-      u8g_DrawVLine(u8g, x0+x, y0, y+1);
-      u8g_DrawVLine(u8g, x0+y, y0, x+1);
+      xl -= x;
+      w += x;
     }
-    
-    /* lower left */
+    if ( option & U8G_DRAW_UPPER_RIGHT )
+      w += x;
+    if ( (u8g_uint_t)(y0-y) >= u8g->current_page.y0 && (u8g_uint_t)(y0-y) <= u8g->current_page.y1 )
+      u8g_draw_disc_hline(u8g, xl, y0-y, w);
+    if ( y == 0 )
+      return;
+  }
+
+  /* lower half */
+  if ( option & (U8G_DRAW_LOWER_LEFT|U8G_DRAW_LOWER_RIGHT) )
+  {
+    xl = x0;
+    w = 1;
     if ( option & U8G_DRAW_LOWER_LEFT )
     {
-      u8g_DrawVLine(u8g, x0-x, y0, y+1);
-      u8g_DrawVLine(u8g, x0-y, y0, x+1);
+      xl -= x;
+      w += x;
     }
+    if ( option & U8G_DRAW_LOWER_RIGHT )
+      w += x;
+    if ( (u8g_uint_t)(y0+y) >= u8g->current_page.y0 && (u8g_uint_t)(y0+y) <= u8g->current_page.y1 )
+      u8g_draw_disc_hline(u8g, xl, y0+y, w);
+  }
 }
 
 void u8g_draw_disc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option)
@@ -340,12 +368,18 @@ void u8g_draw_disc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uin
   x = 0;
   y = rad;
 
-  u8g_draw_disc_section(u8g, x, y, x0, y0, option);
+  /* 
+    octant with x < y: row y gets the largest x of the points with this y,
+    the span is drawn before y is decremented
+    octant with x > y: each point (x,y) is the end of the row x with width y
+  */
+  u8g_draw_disc_span(u8g, y, x, x0, y0, option);
   
   while ( x < y )
   {
     if (f >= 0) 
     {
+      u8g_draw_disc_span(u8g, x, y, x0, y0, option);
       y--;
       ddF_y += 2;
       f += ddF_y;
@@ -354,8 +388,9 @@ void u8g_draw_disc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uin
     ddF_x += 2;
     f += ddF_x;
 
-    u8g_draw_disc_section(u8g, x, y, x0, y0, option);    
+    u8g_draw_disc_span(u8g, y, x, x0, y0, option);
   }
+  u8g_draw_disc_span(u8g, x, y, x0, y0, option);
 }
 
 void u8g_DrawDisc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option)
@@ -62,6 +62,9 @@
 #define I2C_CMD_MODE    0x000
 #define I2C_DATA_MODE   0x040
 
+/* command mode, NOP (SSD1306 and SH1106) */
+static const uint8_t u8g_com_arduino_ssd_probe_seq[2] = { I2C_CMD_MODE, 0x0e3 };
+
 uint8_t u8g_com_arduino_ssd_start_sequence(u8g_t *u8g)
 {
   /* are we requested to set the a0 state? */
@@ -86,8 +89,62 @@ uint8_t u8g_com_arduino_ssd_start_sequence(u8g_t *u8g)
   return 1;
 }
 
+/* 
+  same as above, but the transfer is only copied into the transmit queue (see u8g_com_i2c.c),
+  errors are detected later by the interrupt and are available with u8g_i2c_get_error()
+*/
+static void u8g_com_arduino_ssd_queue_start_sequence(u8g_t *u8g)
+{
+  if ( u8g->pin_list[U8G_PI_SET_A0] == 0 )
+    return;
+  u8g_i2c_queue_start(I2C_SLA);
+  if ( u8g->pin_list[U8G_PI_A0_STATE] == 0 )
+    u8g_i2c_queue_send_byte(I2C_CMD_MODE);
+  else
+    u8g_i2c_queue_send_byte(I2C_DATA_MODE);
+  u8g->pin_list[U8G_PI_SET_A0] = 0;
+}
+
+static uint8_t u8g_com_arduino_ssd_queue_fn(u8g_t *u8g, uint8_t msg, uint8_t arg_val, void *arg_ptr)
+{
+  switch(msg)
+  {
+    case U8G_COM_MSG_CHIP_SELECT:
+      u8g->pin_list[U8G_PI_A0_STATE] = 0;
+      u8g->pin_list[U8G_PI_SET_A0] = 1;
+      if ( arg_val == 0 )
+	u8g_i2c_queue_stop();
+      break;
+    case U8G_COM_MSG_WRITE_BYTE:
+      u8g_com_arduino_ssd_queue_start_sequence(u8g);
+      u8g_i2c_queue_send_byte(arg_val);
+      break;
+    case U8G_COM_MSG_WRITE_SEQ:
+      u8g_com_arduino_ssd_queue_start_sequence(u8g);
+      u8g_i2c_queue_send_seq(arg_val, arg_ptr);
+      break;
+    case U8G_COM_MSG_WRITE_SEQ_P:
+      u8g_com_arduino_ssd_queue_start_sequence(u8g);
+      {
+        register uint8_t *ptr = arg_ptr;
+        while( arg_val > 0 )
+        {
+	  u8g_i2c_queue_send_byte(u8g_pgm_read(ptr));
+          ptr++;
+          arg_val--;
+        }
+      }
+      break;
+  }
+  return 1;
+}
+
 uint8_t u8g_com_arduino_ssd_i2c_fn(u8g_t *u8g, uint8_t msg, uint8_t arg_val, void *arg_ptr)
 {
+  /* chip select and all write messages use the transmit queue, if it is enabled */
+  if ( msg >= U8G_COM_MSG_CHIP_SELECT && msg != U8G_COM_MSG_RESET && u8g_i2c_queue_is_enabled() )
+    return u8g_com_arduino_ssd_queue_fn(u8g, msg, arg_val, arg_ptr);
+  
   switch(msg)
   {
     case U8G_COM_MSG_INIT:
@@ -96,7 +153,14 @@ uint8_t u8g_com_arduino_ssd_i2c_fn(u8g_t *u8g, uint8_t msg, uint8_t arg_val, voi
       //u8g->pin_list[U8G_PI_A0_STATE] = 0;       /* inital RS state: unknown mode */
     
       u8g_i2c_init(u8g->pin_list[U8G_PI_I2C_OPTION]);
-
+      if ( u8g->pin_list[U8G_PI_I2C_OPTION] & U8G_I2C_OPT_PROBE )
+      {
+        /* step up the speed with a NOP command, FAST limits the probe to 400KHz */
+        if ( u8g->pin_list[U8G_PI_I2C_OPTION] & U8G_I2C_OPT_FAST )
+          u8g_i2c_probe_speed(I2C_SLA, u8g_com_arduino_ssd_probe_seq, 2, 400);
+        else
+          u8g_i2c_probe_speed(I2C_SLA, u8g_com_arduino_ssd_probe_seq, 2, 1000);
+      }
       break;
     
     case U8G_COM_MSG_STOP:
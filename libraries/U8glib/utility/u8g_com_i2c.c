@@ -46,6 +46,8 @@ static uint8_t u8g_i2c_opt;		/* U8G_I2C_OPT_NO_ACK, SAM: U8G_I2C_OPT_DEV_1 */
   position values
     1: start condition
     2: sla transfer
+    5: transmit queue, reported by the interrupt
+    6: transmit queue, timeout
 */
 static uint8_t u8g_i2c_err_pos;
 
@@ -97,6 +99,19 @@ static void u8g_i2c_set_error(uint8_t code, uint8_t pos)
 
 
 void u8g_i2c_init(uint8_t options)
+{
+  u8g_i2c_opt = options;
+  if ( options & U8G_I2C_OPT_FAST_PLUS )
+    u8g_i2c_set_speed(1000);
+  else if ( options & U8G_I2C_OPT_FAST )
+    u8g_i2c_set_speed(400);
+  else
+    u8g_i2c_set_speed(100);
+  u8g_i2c_clear_error();
+}
+
+/* returns the bus speed in KHz, which has been set */
+uint16_t u8g_i2c_set_speed(uint16_t khz)
 {
   /*
   TWBR: bit rate register
@@ -123,19 +138,33 @@ void u8g_i2c_init(uint8_t options)
     TWSR = 0;
 	--> 400KHz
 
+    TWBR = 0;
+    TWSR = 0;
+	--> 1000KHz (fast mode plus, the fastest possible speed for 16MHz, 500KHz for 8MHz)
+
     F_CPU/(2*100000)-8  --> calculate TWBR value for 100KHz
+    
+  The datasheets of older AVRs require TWBR >= 10 in master mode. Displays 
+  and AVRs which fail at the higher speeds are detected by u8g_i2c_probe_speed().
 */
-  u8g_i2c_opt = options;
+  uint32_t twbr;
+  
+  u8g_i2c_queue_wait();		/* do not change the bit rate during a queued transfer */
+  if ( khz < 40 )
+    khz = 40;
+  twbr = F_CPU/(2000UL*khz);
+  if ( twbr < 8 )
+    twbr = 8;
+  if ( twbr > 255+8 )
+    twbr = 255+8;
   TWSR = 0;
-  if ( options & U8G_I2C_OPT_FAST )
-  {
-    TWBR = F_CPU/(2*400000)-8;
-  }
-  else
-  {  
-    TWBR = F_CPU/(2*100000)-8;
-  }
-  u8g_i2c_clear_error();
+  TWBR = twbr-8;
+  return u8g_i2c_get_speed();
+}
+
+uint16_t u8g_i2c_get_speed(void)
+{
+  return F_CPU/(16UL+2UL*TWBR)/1000UL;
 }
 
 uint8_t u8g_i2c_wait(uint8_t mask, uint8_t pos)
@@ -244,6 +273,318 @@ void u8g_i2c_stop(void)
   
 }
 
+#if defined(U8G_WITH_I2C_QUEUE)
+
+#include <avr/interrupt.h>
+
+/*
+  Interrupt driven transmit queue
+
+  u8g_i2c_queue_start(), u8g_i2c_queue_send_byte(), u8g_i2c_queue_send_seq() 
+  and u8g_i2c_queue_stop() only copy the transfer into the ring buffer, which 
+  has been assigned by u8g_i2c_queue_init(). The bytes are sent by the TWI 
+  interrupt, so the picture loop renders the next page while the previous 
+  page is still on the bus. The CPU waits only if the ring buffer is full.
+  A page of the SSD1306/SH1106 requires 147 bytes, see u8g_i2c_queue_init().
+
+  The ring buffer is a sequence of chunks: A header byte followed by up to 127 
+  bytes. The lower 7 bits of the header are the number of bytes, bit 7 requests 
+  a (repeated) start condition before the first byte (which is the SLA).
+  A header with value 0 ends the transfer: The stop condition is sent, 
+  unless the next transfer is already waiting, then a repeated start is used.
+  If the ring buffer runs empty within a transfer, SCL is kept low until 
+  the next chunk arrives.
+  
+  Errors are detected by the interrupt: All queued bytes are removed and the 
+  error is available with u8g_i2c_get_error(). The SSD1306/SH1106 devices 
+  call u8g_i2c_queue_is_lost() with the first page and send all pages again 
+  after an error, because their checksums may cover pages which were removed.
+  
+  The TWI interrupt is defined here: This can not be used together with the 
+  Wire library. The queue is compiled only if U8G_WITH_I2C_QUEUE is defined
+  in u8g.h, otherwise u8g_i2c_queue_init() does nothing and every transfer
+  waits for the bus.
+*/
+
+#define U8G_I2C_QUEUE_CHUNK 32
+
+#define U8G_I2C_QUEUE_IDLE 0
+#define U8G_I2C_QUEUE_BUSY 1
+#define U8G_I2C_QUEUE_HOLD 2
+
+static uint8_t *u8g_i2c_q_buf;
+static uint8_t u8g_i2c_q_size;
+static volatile uint8_t u8g_i2c_q_head;	/* next free position, written by u8g_i2c_queue_put() */
+static volatile uint8_t u8g_i2c_q_tail;	/* next byte to send, written by the interrupt */
+static volatile uint8_t u8g_i2c_q_cnt;		/* remaining bytes of the current chunk */
+static volatile uint8_t u8g_i2c_q_state;
+static uint8_t u8g_i2c_q_is_open;		/* start has been queued, but not the stop */
+static volatile uint8_t u8g_i2c_q_lost;	/* queued bytes have been removed, see u8g_i2c_queue_is_lost() */
+
+static uint8_t u8g_i2c_queue_inc(uint8_t pos)
+{
+  pos++;
+  if ( pos >= u8g_i2c_q_size )
+    pos = 0;
+  return pos;
+}
+
+static uint8_t u8g_i2c_queue_free(void)
+{
+  uint8_t head = u8g_i2c_q_head;
+  uint8_t tail = u8g_i2c_q_tail;
+  if ( tail > head )
+    return tail - head - 1;
+  return u8g_i2c_q_size - (head - tail) - 1;
+}
+
+/* send the next byte, start or stop condition, called by the interrupt or with disabled interrupts */
+static void u8g_i2c_queue_next(void)
+{
+  uint8_t tail = u8g_i2c_q_tail;
+  uint8_t hdr;
+  
+  for(;;)
+  {
+    if ( u8g_i2c_q_cnt > 0 )
+    {
+      TWDR = u8g_i2c_q_buf[tail];
+      u8g_i2c_q_tail = u8g_i2c_queue_inc(tail);
+      u8g_i2c_q_cnt--;
+      TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWIE);
+      u8g_i2c_q_state = U8G_I2C_QUEUE_BUSY;
+      return;
+    }
+    
+    if ( tail == u8g_i2c_q_head )
+    {
+      if ( u8g_i2c_q_state != U8G_I2C_QUEUE_IDLE )
+      {
+	/* TWINT is not cleared: the bus is held until the next chunk arrives */
+	TWCR = _BV(TWEN);
+	u8g_i2c_q_state = U8G_I2C_QUEUE_HOLD;
+      }
+      return;
+    }
+    
+    hdr = u8g_i2c_q_buf[tail];
+    tail = u8g_i2c_queue_inc(tail);
+    u8g_i2c_q_tail = tail;
+    
+    if ( hdr == 0 )
+    {
+      /* end of transfer, use a repeated start if the next transfer is already available */
+      if ( tail == u8g_i2c_q_head && u8g_i2c_q_state != U8G_I2C_QUEUE_IDLE )
+      {
+	TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWSTO);
+	u8g_i2c_q_state = U8G_I2C_QUEUE_IDLE;
+	return;
+      }
+    }
+    else if ( hdr & 0x080 )
+    {
+      u8g_i2c_q_cnt = hdr & 0x07f;
+      TWCR = _BV(TWINT) | _BV(TWSTA) | _BV(TWEN) | _BV(TWIE);
+      u8g_i2c_q_state = U8G_I2C_QUEUE_BUSY;
+      return;
+    }
+    else if ( u8g_i2c_q_state == U8G_I2C_QUEUE_IDLE )
+    {
+      /* the start of this transfer has been removed after an error */
+      hdr &= 0x07f;
+      while( hdr > 0 )
+      {
+	tail = u8g_i2c_queue_inc(tail);
+	hdr--;
+      }
+      u8g_i2c_q_tail = tail;
+    }
+    else
+    {
+      u8g_i2c_q_cnt = hdr;
+    }
+  }
+}
+
+/* stop any transfer and remove all queued bytes */
+static void u8g_i2c_queue_reset(uint8_t code, uint8_t pos)
+{
+  TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWSTO);
+  u8g_i2c_q_tail = u8g_i2c_q_head;
+  u8g_i2c_q_cnt = 0;
+  u8g_i2c_q_state = U8G_I2C_QUEUE_IDLE;
+  u8g_i2c_q_lost = 1;
+  u8g_i2c_set_error(code, pos);
+}
+
+ISR(TWI_vect)
+{
+  register uint8_t status;
+  
+  if ( (u8g_i2c_opt & U8G_I2C_OPT_NO_ACK) == 0 )
+  {
+    status = TW_STATUS;
+    if ( status != TW_START && status != TW_REP_START && status != TW_MT_SLA_ACK && status != TW_MT_DATA_ACK )
+    {
+      u8g_i2c_queue_reset(U8G_I2C_ERR_BUS, 5);
+      return;
+    }
+  }
+  u8g_i2c_queue_next();
+}
+
+/* 
+  wait until n bytes are free in the ring buffer (n = size-1: wait until the transfer is finished)
+  the timeout is restarted whenever the interrupt makes some progress
+*/
+static uint8_t u8g_i2c_queue_wait_free(uint8_t n)
+{
+  volatile uint16_t cnt = 2000;	/* same as u8g_i2c_wait(), but for each byte */
+  uint8_t tail = u8g_i2c_q_tail;
+  uint8_t sreg;
+  
+  for(;;)
+  {
+    if ( u8g_i2c_queue_free() >= n )
+    {
+      if ( n < u8g_i2c_q_size-1 )
+	return 1;
+      if ( u8g_i2c_q_state == U8G_I2C_QUEUE_IDLE && (TWCR & _BV(TWSTO)) == 0 )
+	return 1;
+    }
+    if ( tail != u8g_i2c_q_tail )
+    {
+      tail = u8g_i2c_q_tail;
+      cnt = 2000;
+    }
+    if ( cnt == 0 )
+    {
+      sreg = SREG;
+      cli();
+      u8g_i2c_queue_reset(U8G_I2C_ERR_TIMEOUT, 6);
+      SREG = sreg;
+      return 0;
+    }
+    cnt--;
+  }
+}
+
+/* copy one chunk into the ring buffer and restart the interrupt if required */
+static void u8g_i2c_queue_put(uint8_t is_start, const uint8_t *ptr, uint8_t cnt)
+{
+  uint8_t head, pos, sreg;
+  volatile uint8_t wait;
+  
+  if ( u8g_i2c_queue_wait_free(cnt+1) == 0 )
+    return;
+  
+  head = u8g_i2c_q_head;
+  u8g_i2c_q_buf[head] = cnt | is_start;
+  pos = u8g_i2c_queue_inc(head);
+  while( cnt > 0 )
+  {
+    u8g_i2c_q_buf[pos] = *ptr++;
+    pos = u8g_i2c_queue_inc(pos);
+    cnt--;
+  }
+
+  sreg = SREG;
+  cli();
+  u8g_i2c_q_head = pos;
+  if ( u8g_i2c_q_state != U8G_I2C_QUEUE_BUSY )
+  {
+    /* a new start condition must not be requested before the last stop condition is sent */
+    wait = 200;
+    while( (TWCR & _BV(TWSTO)) && wait > 0 )
+      wait--;
+    u8g_i2c_queue_next();
+  }
+  SREG = sreg;
+}
+
+/* 
+  buf = NULL or size < 34 disables the queue 
+  one page of the SSD1306/SH1106 takes 147 bytes in the ring buffer, so size should 
+  be at least 150 (300 for the 2x devices): with a smaller buffer, every page waits 
+  for the bus until the remaining bytes fit
+*/
+void u8g_i2c_queue_init(uint8_t *buf, uint8_t size)
+{
+  u8g_i2c_queue_wait();
+  if ( size < U8G_I2C_QUEUE_CHUNK+2 )
+    buf = NULL;
+  u8g_i2c_q_buf = buf;
+  u8g_i2c_q_size = size;
+  u8g_i2c_q_head = 0;
+  u8g_i2c_q_tail = 0;
+  u8g_i2c_q_cnt = 0;
+  u8g_i2c_q_state = U8G_I2C_QUEUE_IDLE;
+  u8g_i2c_q_is_open = 0;
+}
+
+uint8_t u8g_i2c_queue_is_enabled(void)
+{
+  return u8g_i2c_q_buf != NULL;
+}
+
+/* 
+  returns 1 if queued bytes have been removed after an error since the last call:
+  the display may show old content for any page which has been queued before
+*/
+uint8_t u8g_i2c_queue_is_lost(void)
+{
+  uint8_t lost, sreg;
+  sreg = SREG;
+  cli();
+  lost = u8g_i2c_q_lost;
+  u8g_i2c_q_lost = 0;
+  SREG = sreg;
+  return lost;
+}
+
+/* sla includes all 8 bits (with r/w bit), a repeated start is used if the previous transfer is still open */
+void u8g_i2c_queue_start(uint8_t sla)
+{
+  u8g_i2c_queue_put(0x080, &sla, 1);
+  u8g_i2c_q_is_open = 1;
+}
+
+void u8g_i2c_queue_send_byte(uint8_t data)
+{
+  u8g_i2c_queue_put(0, &data, 1);
+}
+
+void u8g_i2c_queue_send_seq(uint8_t cnt, const uint8_t *ptr)
+{
+  while( cnt > U8G_I2C_QUEUE_CHUNK )
+  {
+    u8g_i2c_queue_put(0, ptr, U8G_I2C_QUEUE_CHUNK);
+    ptr += U8G_I2C_QUEUE_CHUNK;
+    cnt -= U8G_I2C_QUEUE_CHUNK;
+  }
+  if ( cnt > 0 )
+    u8g_i2c_queue_put(0, ptr, cnt);
+}
+
+void u8g_i2c_queue_stop(void)
+{
+  if ( u8g_i2c_q_is_open == 0 )
+    return;
+  u8g_i2c_queue_put(0, NULL, 0);
+  u8g_i2c_q_is_open = 0;
+}
+
+/* close the current transfer and wait until all bytes are sent, returns 0 after a timeout */
+uint8_t u8g_i2c_queue_wait(void)
+{
+  if ( u8g_i2c_q_buf == NULL )
+    return 1;
+  u8g_i2c_queue_stop();
+  return u8g_i2c_queue_wait_free(u8g_i2c_q_size-1);
+}
+
+#endif /* U8G_WITH_I2C_QUEUE */
+
 /*
 void twi_send(uint8_t adr, uint8_t data1, uint8_t data2)
 {
@@ -331,10 +672,16 @@ static void i2c_100KHz_delay(void)
 }
 
 
+static void i2c_no_delay(void)
+{
+  /* as fast as possible, ca. 470KHz (see above) */
+}
+
 uint32_t i2c_started = 0;
 uint32_t i2c_scl_pin = 0;
 uint32_t i2c_sda_pin = 0;
 void (*i2c_delay)(void) = i2c_100KHz_delay;
+static uint16_t i2c_speed = 80;
 
 const PinDescription *i2c_scl_pin_desc;
 const PinDescription *i2c_sda_pin_desc;
@@ -508,13 +855,17 @@ void u8g_i2c_init(uint8_t options)
   u8g_i2c_opt = options;
   u8g_i2c_clear_error();
 
-  if ( u8g_i2c_opt & U8G_I2C_OPT_FAST )
+  if ( u8g_i2c_opt & U8G_I2C_OPT_FAST_PLUS )
   {
-    i2c_delay = i2c_400KHz_delay;
+    u8g_i2c_set_speed(1000);
+  }
+  else if ( u8g_i2c_opt & U8G_I2C_OPT_FAST )
+  {
+    u8g_i2c_set_speed(400);
   }
   else
   {
-    i2c_delay = i2c_100KHz_delay;
+    u8g_i2c_set_speed(100);
   }
 
 
@@ -538,6 +889,32 @@ void u8g_i2c_init(uint8_t options)
 
 }
 
+/* software i2c: the speed is selected by the delay procedure, returns the approximate speed in KHz */
+uint16_t u8g_i2c_set_speed(uint16_t khz)
+{
+  if ( khz >= 1000 )
+  {
+    i2c_delay = i2c_no_delay;
+    i2c_speed = 470;
+  }
+  else if ( khz >= 400 )
+  {
+    i2c_delay = i2c_400KHz_delay;
+    i2c_speed = 400;
+  }
+  else
+  {
+    i2c_delay = i2c_100KHz_delay;
+    i2c_speed = 80;
+  }
+  return i2c_speed;
+}
+
+uint16_t u8g_i2c_get_speed(void)
+{
+  return i2c_speed;
+}
+
 /* sla includes also the r/w bit */
 uint8_t u8g_i2c_start(uint8_t sla)
 {  
@@ -611,6 +988,17 @@ uint8_t u8g_i2c_wait(uint8_t mask, uint8_t pos)
   return 1;
 }
 
+/* the bus speed is defined by the kernel driver */
+uint16_t u8g_i2c_set_speed(uint16_t khz)
+{
+  return 0;
+}
+
+uint16_t u8g_i2c_get_speed(void)
+{
+  return 0;
+}
+
 #else
 
 /* empty interface */
@@ -638,6 +1026,120 @@ void u8g_i2c_stop(void)
 {
 }
 
+uint16_t u8g_i2c_set_speed(uint16_t khz)
+{
+  return 0;
+}
+
+uint16_t u8g_i2c_get_speed(void)
+{
+  return 0;
+}
 
 #endif
 
+/*===============================================================*/
+/* bus speed probe */
+
+#define U8G_I2C_PROBE_CNT 8
+
+static uint8_t u8g_i2c_probe_transfer(uint8_t sla, const uint8_t *data, uint8_t cnt)
+{
+  uint8_t is_ok = 0;
+  if ( u8g_i2c_start(sla) != 0 )
+  {
+    while( cnt > 0 )
+    {
+      if ( u8g_i2c_send_byte(*data++) == 0 )
+	break;
+      cnt--;
+    }
+    if ( cnt == 0 )
+      is_ok = 1;
+  }
+  u8g_i2c_stop();
+  return is_ok;
+}
+
+/*
+  Start with 100KHz and double the speed up to max_khz. At each speed, the 
+  transfer "sla, data[0], ..., data[cnt-1]" is sent several times. The first 
+  error stops the probe and the last speed without errors is used (the error 
+  is cleared). The data should not change the state of the device, 
+  e.g. a NOP command.
+  Returns the selected speed in KHz (see u8g_i2c_get_speed()) or 0 if the 
+  device did not acknowledge at 100KHz (the error is kept in this case).
+  Without acknowledge (U8G_I2C_OPT_NO_ACK) every speed will pass.
+*/
+uint16_t u8g_i2c_probe_speed(uint8_t sla, const uint8_t *data, uint8_t cnt, uint16_t max_khz)
+{
+  uint16_t khz = 100;
+  uint16_t good = 0;
+  uint8_t i;
+  
+  for(;;)
+  {
+    u8g_i2c_set_speed(khz);
+    u8g_i2c_clear_error();
+    for( i = 0; i < U8G_I2C_PROBE_CNT; i++ )
+      if ( u8g_i2c_probe_transfer(sla, data, cnt) == 0 )
+	break;
+    if ( i < U8G_I2C_PROBE_CNT )
+      break;
+    good = khz;
+    if ( khz >= max_khz )
+      break;
+    khz *= 2;
+    if ( khz > max_khz )
+      khz = max_khz;
+  }
+  
+  if ( good == 0 )
+  {
+    u8g_i2c_set_speed(100);
+    return 0;
+  }
+  u8g_i2c_clear_error();
+  return u8g_i2c_set_speed(good);
+}
+
+#if !defined(U8G_ATMEGA_HW_TWI) || !defined(U8G_WITH_I2C_QUEUE)
+
+/* no transmit queue: u8g_i2c_queue_is_enabled() always returns 0 */
+
+void u8g_i2c_queue_init(uint8_t *buf, uint8_t size)
+{
+}
+
+uint8_t u8g_i2c_queue_is_enabled(void)
+{
+  return 0;
+}
+
+uint8_t u8g_i2c_queue_is_lost(void)
+{
+  return 0;
+}
+
+void u8g_i2c_queue_start(uint8_t sla)
+{
+}
+
+void u8g_i2c_queue_send_byte(uint8_t data)
+{
+}
+
+void u8g_i2c_queue_send_seq(uint8_t cnt, const uint8_t *ptr)
+{
+}
+
+void u8g_i2c_queue_stop(void)
+{
+}
+
+uint8_t u8g_i2c_queue_wait(void)
+{
+  return 1;
+}
+
+#endif
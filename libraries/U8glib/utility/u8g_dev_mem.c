@@ -0,0 +1,327 @@
+/*
+
+  u8g_dev_mem.c
+
+  In-memory image devices for host builds (not for Arduino).
+  The pages are assembled into one image with one byte (color index) 
+  for each pixel. The image can be written to a PBM, PGM or PPM file
+  and compared against another device or a previously written file.
+  
+  u8g_dev_mem_128x64		monochrom, pages like the SSD1306/SH1106 (pb8v1)
+  u8g_dev_mem_128x64_gr	2 bit gray (pb8v2)
+  u8g_dev_mem_128x64_332	8 bit R3G3B2 (pb8h8)
+
+  Universal 8bit Graphics Library
+  
+  Copyright (c) 2011, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, 
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list 
+    of conditions and the following disclaimer.
+    
+  * Redistributions in binary form must reproduce the above copyright notice, this 
+    list of conditions and the following disclaimer in the documentation and/or other 
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT 
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  
+  
+  
+
+*/
+
+#include "u8g.h"
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+
+#include <stdio.h>
+#include <string.h>
+
+#define WIDTH 128
+#define HEIGHT 64
+
+struct _u8g_dev_mem_t
+{
+  u8g_pb_t pb;		/* must be the first member, used by the page buffer procedures */
+  uint8_t mode;		/* U8G_MODE_BW, U8G_MODE_GRAY2BIT or U8G_MODE_R3G3B2 */
+  uint8_t *image;	/* WIDTH*HEIGHT color indices, row by row */
+};
+typedef struct _u8g_dev_mem_t u8g_dev_mem_t;
+
+uint8_t u8g_dev_mem_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+
+#define U8G_DEV_MEM(name, page_height, buf_size, mode) \
+uint8_t name##_buf[buf_size]; \
+uint8_t name##_image[WIDTH*HEIGHT]; \
+u8g_dev_mem_t name##_mem = { { {page_height, HEIGHT, 0, 0, 0}, WIDTH, name##_buf }, mode, name##_image }; \
+u8g_dev_t name = { u8g_dev_mem_fn, &name##_mem, NULL }
+
+U8G_DEV_MEM(u8g_dev_mem_128x64, 8, WIDTH, U8G_MODE_BW);
+U8G_DEV_MEM(u8g_dev_mem_128x64_gr, 4, WIDTH, U8G_MODE_GRAY2BIT);
+U8G_DEV_MEM(u8g_dev_mem_128x64_332, 8, WIDTH*8, U8G_MODE_R3G3B2);
+
+/* color index of a pixel in the current page, y is relative to the page */
+static uint8_t u8g_dev_mem_get_page_pixel(u8g_dev_mem_t *mem, u8g_uint_t x, u8g_uint_t y)
+{
+  uint8_t *buf = mem->pb.buf;
+  switch(mem->mode)
+  {
+    case U8G_MODE_BW:
+      return (buf[x] >> y) & 1;
+    case U8G_MODE_GRAY2BIT:
+      return (buf[x] >> (y*2)) & 3;
+  }
+  return buf[y*WIDTH + x];
+}
+
+static void u8g_dev_mem_copy_page(u8g_dev_mem_t *mem)
+{
+  u8g_uint_t x, y;
+  uint8_t *ptr;
+  for( y = mem->pb.p.page_y0; y <= mem->pb.p.page_y1; y++ )
+  {
+    ptr = mem->image + y*WIDTH;
+    for( x = 0; x < WIDTH; x++ )
+      ptr[x] = u8g_dev_mem_get_page_pixel(mem, x, y - mem->pb.p.page_y0);
+  }
+}
+
+uint8_t u8g_dev_mem_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+  u8g_dev_mem_t *mem = (u8g_dev_mem_t *)(dev->dev_mem);
+  
+  switch(msg)
+  {
+    case U8G_DEV_MSG_INIT:
+      memset(mem->image, 0, WIDTH*HEIGHT);
+      break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      u8g_dev_mem_copy_page(mem);
+      break;
+  }
+  switch(mem->mode)
+  {
+    case U8G_MODE_BW:
+      return u8g_dev_pb8v1_base_fn(u8g, dev, msg, arg);
+    case U8G_MODE_GRAY2BIT:
+      return u8g_dev_pb8v2_base_fn(u8g, dev, msg, arg);
+  }
+  return u8g_dev_pb8h8_base_fn(u8g, dev, msg, arg);
+}
+
+/*===============================================================*/
+/* image access */
+
+uint8_t *u8g_dev_mem_GetImage(u8g_dev_t *dev)
+{
+  return ((u8g_dev_mem_t *)(dev->dev_mem))->image;
+}
+
+uint8_t u8g_dev_mem_GetPixel(u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y)
+{
+  if ( x >= WIDTH || y >= HEIGHT )
+    return 0;
+  return u8g_dev_mem_GetImage(dev)[y*WIDTH + x];
+}
+
+/* number of different pixels, both devices must have the same mode */
+int u8g_dev_mem_Compare(u8g_dev_t *dev, u8g_dev_t *ref)
+{
+  uint8_t *a = u8g_dev_mem_GetImage(dev);
+  uint8_t *b = u8g_dev_mem_GetImage(ref);
+  int i, cnt = 0;
+  for( i = 0; i < WIDTH*HEIGHT; i++ )
+    if ( a[i] != b[i] )
+      cnt++;
+  return cnt;
+}
+
+/*===============================================================*/
+/* PBM (P4), PGM (P5) and PPM (P6) files */
+
+/* R3G3B2 --> 8 bit per color */
+static void u8g_dev_mem_332_to_rgb(uint8_t c, uint8_t *rgb)
+{
+  rgb[0] = ((c >> 5) * 255) / 7;
+  rgb[1] = (((c >> 2) & 7) * 255) / 7;
+  rgb[2] = ((c & 3) * 255) / 3;
+}
+
+static uint8_t u8g_dev_mem_rgb_to_332(const uint8_t *rgb)
+{
+  return (((rgb[0]*7+127)/255) << 5) | (((rgb[1]*7+127)/255) << 2) | ((rgb[2]*3+127)/255);
+}
+
+/* 
+  monochrom: PBM, a set pixel is black (1)
+  gray: PGM with maxval 3
+  R3G3B2: PPM
+  returns 0 if the file could not be written
+*/
+uint8_t u8g_dev_mem_WriteFile(u8g_dev_t *dev, const char *name)
+{
+  u8g_dev_mem_t *mem = (u8g_dev_mem_t *)(dev->dev_mem);
+  uint8_t *ptr = mem->image;
+  uint8_t rgb[3];
+  uint8_t b;
+  int x, y;
+  FILE *fp;
+  
+  fp = fopen(name, "wb");
+  if ( fp == NULL )
+    return 0;
+  switch(mem->mode)
+  {
+    case U8G_MODE_BW:
+      fprintf(fp, "P4\n%d %d\n", WIDTH, HEIGHT);
+      for( y = 0; y < HEIGHT; y++ )
+      {
+        b = 0;
+        for( x = 0; x < WIDTH; x++ )
+        {
+          b <<= 1;
+          b |= *ptr++;
+          if ( (x & 7) == 7 )
+          {
+            fputc(b, fp);
+            b = 0;
+          }
+        }
+      }
+      break;
+    case U8G_MODE_GRAY2BIT:
+      fprintf(fp, "P5\n%d %d\n3\n", WIDTH, HEIGHT);
+      fwrite(ptr, 1, WIDTH*HEIGHT, fp);
+      break;
+    default:
+      fprintf(fp, "P6\n%d %d\n255\n", WIDTH, HEIGHT);
+      for( x = 0; x < WIDTH*HEIGHT; x++ )
+      {
+        u8g_dev_mem_332_to_rgb(*ptr++, rgb);
+        fwrite(rgb, 1, 3, fp);
+      }
+      break;
+  }
+  return fclose(fp) == 0;
+}
+
+/* read the next number of the header, skip white space and comments */
+static int u8g_dev_mem_read_header_value(FILE *fp)
+{
+  int c, v = 0;
+  for(;;)
+  {
+    c = fgetc(fp);
+    if ( c == '#' )
+    {
+      while( c != '\n' && c != EOF )
+        c = fgetc(fp);
+    }
+    else if ( c < '0' || c > '9' )
+    {
+      if ( c == EOF )
+        return -1;
+    }
+    else
+      break;
+  }
+  while( c >= '0' && c <= '9' )
+  {
+    v = v*10 + c - '0';
+    c = fgetc(fp);
+  }
+  /* c is the single white space character after the value */
+  return v;
+}
+
+/* 
+  compare the image with a file, which has been written by u8g_dev_mem_WriteFile()
+  returns the number of different pixels or -1 if the file can not be read 
+  or does not match size and mode of the device
+*/
+int u8g_dev_mem_CompareFile(u8g_dev_t *dev, const char *name)
+{
+  u8g_dev_mem_t *mem = (u8g_dev_mem_t *)(dev->dev_mem);
+  uint8_t *ptr = mem->image;
+  uint8_t rgb[3];
+  int type, maxval = 0, x, y, c, i, cnt = 0;
+  FILE *fp;
+  
+  fp = fopen(name, "rb");
+  if ( fp == NULL )
+    return -1;
+  if ( fgetc(fp) != 'P' )
+    type = -1;
+  else
+    type = fgetc(fp) - '0';
+  if ( u8g_dev_mem_read_header_value(fp) != WIDTH || u8g_dev_mem_read_header_value(fp) != HEIGHT )
+    type = -1;
+  if ( type == 5 || type == 6 )
+    maxval = u8g_dev_mem_read_header_value(fp);
+  
+  if ( type == 4 && mem->mode == U8G_MODE_BW )
+  {
+    for( y = 0; y < HEIGHT && cnt >= 0; y++ )
+      for( x = 0; x < WIDTH; x += 8 )
+      {
+        c = fgetc(fp);
+        if ( c == EOF )
+        {
+          cnt = -1;
+          break;
+        }
+        for( i = 7; i >= 0; i-- )
+          if ( ((c >> i) & 1) != *ptr++ )
+            cnt++;
+      }
+  }
+  else if ( type == 5 && maxval == 3 && mem->mode == U8G_MODE_GRAY2BIT )
+  {
+    for( x = 0; x < WIDTH*HEIGHT; x++ )
+    {
+      c = fgetc(fp);
+      if ( c == EOF )
+      {
+        cnt = -1;
+        break;
+      }
+      if ( c != *ptr++ )
+        cnt++;
+    }
+  }
+  else if ( type == 6 && maxval == 255 && mem->mode == U8G_MODE_R3G3B2 )
+  {
+    for( x = 0; x < WIDTH*HEIGHT; x++ )
+    {
+      if ( fread(rgb, 1, 3, fp) != 3 )
+      {
+        cnt = -1;
+        break;
+      }
+      if ( u8g_dev_mem_rgb_to_332(rgb) != *ptr++ )
+        cnt++;
+    }
+  }
+  else
+  {
+    cnt = -1;
+  }
+  fclose(fp);
+  return cnt;
+}
+
+#endif
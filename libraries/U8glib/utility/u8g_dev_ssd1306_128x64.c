@@ -40,6 +40,15 @@
 #define HEIGHT 64
 #define PAGE_HEIGHT 8
 
+/* segment remap and com scan direction, see U8G_SSD13XX_ROT180 in u8g.h */
+#ifdef U8G_SSD13XX_ROT180
+#define SEG_REMAP 0x0a0
+#define COM_SCAN 0x0c0
+#else
+#define SEG_REMAP 0x0a1
+#define COM_SCAN 0x0c8
+#endif
+
 /* init sequence adafruit 128x64 OLED (NOT TESTED) */
 static const uint8_t u8g_dev_ssd1306_128x64_adafruit1_init_seq[] PROGMEM = {
   U8G_ESC_CS(0),             /* disable chip */
@@ -58,8 +67,8 @@ static const uint8_t u8g_dev_ssd1306_128x64_adafruit1_init_seq[] PROGMEM = {
   0x08d, 0x010,		/* [1] charge pump setting (p62): 0x014 enable, 0x010 disable */
 
   0x020, 0x000,		/* */
-  0x0a1,				/* segment remap a0/a1*/
-  0x0c8,				/* c0: scan dir normal, c8: reverse */
+  SEG_REMAP,			/* segment remap a0/a1*/
+  COM_SCAN,			/* c0: scan dir normal, c8: reverse */
   0x0da, 0x012,		/* com pin HW config, sequential com pin config (bit 4), disable left/right remap (bit 5) */
   0x081, 0x09f,		/* [1] set contrast control */
   0x0d9, 0x022,		/* [1] pre-charge period 0x022/f1*/
@@ -92,8 +101,8 @@ static const uint8_t u8g_dev_ssd1306_128x64_adafruit2_init_seq[] PROGMEM = {
   0x08d, 0x014,		/* [2] charge pump setting (p62): 0x014 enable, 0x010 disable */
 
   0x020, 0x000,		/* */
-  0x0a1,				/* segment remap a0/a1*/
-  0x0c8,				/* c0: scan dir normal, c8: reverse */
+  SEG_REMAP,			/* segment remap a0/a1*/
+  COM_SCAN,			/* c0: scan dir normal, c8: reverse */
   0x0da, 0x012,		/* com pin HW config, sequential com pin config (bit 4), disable left/right remap (bit 5) */
   0x081, 0x0cf,		/* [2] set contrast control */
   0x0d9, 0x0f1,		/* [2] pre-charge period 0x022/f1*/
@@ -126,8 +135,8 @@ static const uint8_t u8g_dev_ssd1306_128x64_adafruit3_init_seq[] PROGMEM = {
   0x08d, 0x014,		/* [2] charge pump setting (p62): 0x014 enable, 0x010 disable */
 
   0x020, 0x002,		/* 2012-05-27: page addressing mode */
-  0x0a1,				/* segment remap a0/a1*/
-  0x0c8,				/* c0: scan dir normal, c8: reverse */
+  SEG_REMAP,			/* segment remap a0/a1*/
+  COM_SCAN,			/* c0: scan dir normal, c8: reverse */
   0x0da, 0x012,		/* com pin HW config, sequential com pin config (bit 4), disable left/right remap (bit 5) */
   0x081, 0x0cf,		/* [2] set contrast control */
   0x0d9, 0x0f1,		/* [2] pre-charge period 0x022/f1*/
@@ -155,8 +164,8 @@ static const uint8_t u8g_dev_ssd1306_128x64_univision_init_seq[] PROGMEM = {
   0x0d3, 0x000,		/* display offset */
   0x040,				/* start line */
   0x08d, 0x010,		/* charge pump setting (p62): 0x014 enable, 0x010 disable */
-  0x0a1,				/* segment remap a0/a1*/
-  0x0c8,				/* c0: scan dir normal, c8: reverse */
+  SEG_REMAP,			/* segment remap a0/a1*/
+  COM_SCAN,			/* c0: scan dir normal, c8: reverse */
   0x0da, 0x012,		/* com pin HW config, sequential com pin config (bit 4), disable left/right remap (bit 5) */
   0x081, 0x09f,		/* set contrast control */
   0x0d9, 0x022,		/* pre-charge period */
@@ -213,25 +222,36 @@ static const uint8_t u8g_dev_ssd13xx_sleep_off[] PROGMEM = {
   U8G_ESC_END                /* end of sequence */
 };
 
+static u8g_pb_sum_t u8g_dev_ssd1306_128x64_sum;
+
 uint8_t u8g_dev_ssd1306_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 {
   switch(msg)
   {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
+      u8g_pb_ResetSum(&u8g_dev_ssd1306_128x64_sum);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_adafruit2_init_seq);
       break;
     case U8G_DEV_MSG_STOP:
       break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      if ( u8g_i2c_queue_is_lost() != 0 )
+        u8g_pb_ResetSum(&u8g_dev_ssd1306_128x64_sum);
+      break;
     case U8G_DEV_MSG_PAGE_NEXT:
       {
         u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_data_start);    
-        u8g_WriteByte(u8g, dev, 0x0b0 | pb->p.page); /* select current page (SSD1306) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-        if ( u8g_pb_WriteBuffer(pb, u8g, dev) == 0 )
-          return 0;
-        u8g_SetChipSelect(u8g, dev, 0);
+        if ( u8g_pb_IsChanged(&u8g_dev_ssd1306_128x64_sum, pb->p.page, pb->width, pb->buf) != 0 )
+        {
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_data_start);    
+          u8g_WriteByte(u8g, dev, 0x0b0 | pb->p.page); /* select current page (SSD1306) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          if ( u8g_pb_WriteBuffer(pb, u8g, dev) == 0 )
+            return 0;
+          u8g_SetChipSelect(u8g, dev, 0);
+          u8g_pb_SetSumValid(&u8g_dev_ssd1306_128x64_sum, pb->p.page);
+        }
       }
       break;
     case U8G_DEV_MSG_SLEEP_ON:
@@ -244,25 +264,36 @@ uint8_t u8g_dev_ssd1306_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void
   return u8g_dev_pb8v1_base_fn(u8g, dev, msg, arg);
 }
 
+static u8g_pb_sum_t u8g_dev_ssd1306_adafruit_128x64_sum;
+
 uint8_t u8g_dev_ssd1306_adafruit_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 {
   switch(msg)
   {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
+      u8g_pb_ResetSum(&u8g_dev_ssd1306_adafruit_128x64_sum);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
       break;
     case U8G_DEV_MSG_STOP:
       break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      if ( u8g_i2c_queue_is_lost() != 0 )
+        u8g_pb_ResetSum(&u8g_dev_ssd1306_adafruit_128x64_sum);
+      break;
     case U8G_DEV_MSG_PAGE_NEXT:
       {
         u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_data_start);    
-        u8g_WriteByte(u8g, dev, 0x0b0 | pb->p.page); /* select current page (SSD1306) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-        if ( u8g_pb_WriteBuffer(pb, u8g, dev) == 0 )
-          return 0;
-        u8g_SetChipSelect(u8g, dev, 0);
+        if ( u8g_pb_IsChanged(&u8g_dev_ssd1306_adafruit_128x64_sum, pb->p.page, pb->width, pb->buf) != 0 )
+        {
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_data_start);    
+          u8g_WriteByte(u8g, dev, 0x0b0 | pb->p.page); /* select current page (SSD1306) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          if ( u8g_pb_WriteBuffer(pb, u8g, dev) == 0 )
+            return 0;
+          u8g_SetChipSelect(u8g, dev, 0);
+          u8g_pb_SetSumValid(&u8g_dev_ssd1306_adafruit_128x64_sum, pb->p.page);
+        }
       }
       break;
     case U8G_DEV_MSG_SLEEP_ON:
@@ -275,25 +306,36 @@ uint8_t u8g_dev_ssd1306_adafruit_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t m
   return u8g_dev_pb8v1_base_fn(u8g, dev, msg, arg);
 }
 
+static u8g_pb_sum_t u8g_dev_sh1106_128x64_sum;
+
 uint8_t u8g_dev_sh1106_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 {
   switch(msg)
   {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
+      u8g_pb_ResetSum(&u8g_dev_sh1106_128x64_sum);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
       break;
     case U8G_DEV_MSG_STOP:
       break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      if ( u8g_i2c_queue_is_lost() != 0 )
+        u8g_pb_ResetSum(&u8g_dev_sh1106_128x64_sum);
+      break;
     case U8G_DEV_MSG_PAGE_NEXT:
       {
         u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_sh1106_128x64_data_start);    
-        u8g_WriteByte(u8g, dev, 0x0b0 | pb->p.page); /* select current page (SSD1306) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-        if ( u8g_pb_WriteBuffer(pb, u8g, dev) == 0 )
-          return 0;
-        u8g_SetChipSelect(u8g, dev, 0);
+        if ( u8g_pb_IsChanged(&u8g_dev_sh1106_128x64_sum, pb->p.page, pb->width, pb->buf) != 0 )
+        {
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_sh1106_128x64_data_start);    
+          u8g_WriteByte(u8g, dev, 0x0b0 | pb->p.page); /* select current page (SSD1306) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          if ( u8g_pb_WriteBuffer(pb, u8g, dev) == 0 )
+            return 0;
+          u8g_SetChipSelect(u8g, dev, 0);
+          u8g_pb_SetSumValid(&u8g_dev_sh1106_128x64_sum, pb->p.page);
+        }
       }
       break;
     case U8G_DEV_MSG_SLEEP_ON:
@@ -307,31 +349,48 @@ uint8_t u8g_dev_sh1106_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *
 }
 
 
+static u8g_pb_sum_t u8g_dev_ssd1306_128x64_2x_sum;
+
 uint8_t u8g_dev_ssd1306_128x64_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 {
   switch(msg)
   {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
+      u8g_pb_ResetSum(&u8g_dev_ssd1306_128x64_2x_sum);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
       break;
     case U8G_DEV_MSG_STOP:
       break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      if ( u8g_i2c_queue_is_lost() != 0 )
+        u8g_pb_ResetSum(&u8g_dev_ssd1306_128x64_2x_sum);
+      break;
     case U8G_DEV_MSG_PAGE_NEXT:
       {
         u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
 	
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_data_start);    
-        u8g_WriteByte(u8g, dev, 0x0b0 | (pb->p.page*2)); /* select current page (SSD1306) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-	u8g_WriteSequence(u8g, dev, pb->width, pb->buf); 
-        u8g_SetChipSelect(u8g, dev, 0);
+        if ( u8g_pb_IsChanged(&u8g_dev_ssd1306_128x64_2x_sum, pb->p.page*2, pb->width, pb->buf) != 0 )
+        {
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_data_start);    
+          u8g_WriteByte(u8g, dev, 0x0b0 | (pb->p.page*2)); /* select current page (SSD1306) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          if ( u8g_WriteSequence(u8g, dev, pb->width, pb->buf) == 0 )
+            return 0;
+          u8g_SetChipSelect(u8g, dev, 0);
+          u8g_pb_SetSumValid(&u8g_dev_ssd1306_128x64_2x_sum, pb->p.page*2);
+        }
 	
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_data_start);    
-        u8g_WriteByte(u8g, dev, 0x0b0 | (pb->p.page*2+1)); /* select current page (SSD1306) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-	u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)(pb->buf)+pb->width); 
-        u8g_SetChipSelect(u8g, dev, 0);
+        if ( u8g_pb_IsChanged(&u8g_dev_ssd1306_128x64_2x_sum, pb->p.page*2+1, pb->width, (uint8_t *)(pb->buf)+pb->width) != 0 )
+        {
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_data_start);    
+          u8g_WriteByte(u8g, dev, 0x0b0 | (pb->p.page*2+1)); /* select current page (SSD1306) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          if ( u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)(pb->buf)+pb->width) == 0 )
+            return 0;
+          u8g_SetChipSelect(u8g, dev, 0);
+          u8g_pb_SetSumValid(&u8g_dev_ssd1306_128x64_2x_sum, pb->p.page*2+1);
+        }
       }
       break;
     case U8G_DEV_MSG_SLEEP_ON:
@@ -344,31 +403,48 @@ uint8_t u8g_dev_ssd1306_128x64_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
   return u8g_dev_pb16v1_base_fn(u8g, dev, msg, arg);
 }
 
+static u8g_pb_sum_t u8g_dev_sh1106_128x64_2x_sum;
+
 uint8_t u8g_dev_sh1106_128x64_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 {
   switch(msg)
   {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
+      u8g_pb_ResetSum(&u8g_dev_sh1106_128x64_2x_sum);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
       break;
     case U8G_DEV_MSG_STOP:
       break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      if ( u8g_i2c_queue_is_lost() != 0 )
+        u8g_pb_ResetSum(&u8g_dev_sh1106_128x64_2x_sum);
+      break;
     case U8G_DEV_MSG_PAGE_NEXT:
       {
         u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
 	
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_sh1106_128x64_data_start);    
-        u8g_WriteByte(u8g, dev, 0x0b0 | (pb->p.page*2)); /* select current page (SSD1306) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-	u8g_WriteSequence(u8g, dev, pb->width, pb->buf); 
-        u8g_SetChipSelect(u8g, dev, 0);
+        if ( u8g_pb_IsChanged(&u8g_dev_sh1106_128x64_2x_sum, pb->p.page*2, pb->width, pb->buf) != 0 )
+        {
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_sh1106_128x64_data_start);    
+          u8g_WriteByte(u8g, dev, 0x0b0 | (pb->p.page*2)); /* select current page (SSD1306) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          if ( u8g_WriteSequence(u8g, dev, pb->width, pb->buf) == 0 )
+            return 0;
+          u8g_SetChipSelect(u8g, dev, 0);
+          u8g_pb_SetSumValid(&u8g_dev_sh1106_128x64_2x_sum, pb->p.page*2);
+        }
 	
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_sh1106_128x64_data_start);    
-        u8g_WriteByte(u8g, dev, 0x0b0 | (pb->p.page*2+1)); /* select current page (SSD1306) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-	u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)(pb->buf)+pb->width); 
-        u8g_SetChipSelect(u8g, dev, 0);
+        if ( u8g_pb_IsChanged(&u8g_dev_sh1106_128x64_2x_sum, pb->p.page*2+1, pb->width, (uint8_t *)(pb->buf)+pb->width) != 0 )
+        {
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_sh1106_128x64_data_start);    
+          u8g_WriteByte(u8g, dev, 0x0b0 | (pb->p.page*2+1)); /* select current page (SSD1306) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          if ( u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)(pb->buf)+pb->width) == 0 )
+            return 0;
+          u8g_SetChipSelect(u8g, dev, 0);
+          u8g_pb_SetSumValid(&u8g_dev_sh1106_128x64_2x_sum, pb->p.page*2+1);
+        }
       }
       break;
     case U8G_DEV_MSG_SLEEP_ON:
@@ -382,6 +458,98 @@ uint8_t u8g_dev_sh1106_128x64_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, voi
 }
 
 
+/* full frame variants: send the complete frame again, if a queued transfer has failed */
+static void u8g_dev_ssd13xx_fb_check_lost(u8g_dev_t *dev)
+{
+  u8g_pb64v1_t *fb = (u8g_pb64v1_t *)(dev->dev_mem);
+  if ( u8g_i2c_queue_is_lost() != 0 )
+  {
+    fb->dirty = 0x0ff;
+    u8g_pb_ResetSum(&(fb->sum));
+  }
+}
+
+/* full frame variants: transfer the pages which are marked in the dirty bitmap and differ from the content on the display */
+static uint8_t u8g_dev_ssd13xx_fb_write_dirty(u8g_t *u8g, u8g_dev_t *dev, const uint8_t *data_start)
+{
+  u8g_pb64v1_t *fb = (u8g_pb64v1_t *)(dev->dev_mem);
+  uint8_t *ptr = (uint8_t *)(fb->pb.buf);
+  uint8_t page;
+  uint8_t mask = 1;
+  
+  for( page = 0; page < HEIGHT/8; page++ )
+  {
+    if ( (fb->dirty & mask) != 0 && u8g_pb_IsChanged(&(fb->sum), page, fb->pb.width, ptr) != 0 )
+    {
+      u8g_WriteEscSeqP(u8g, dev, data_start);    
+      u8g_WriteByte(u8g, dev, 0x0b0 | page); /* select current page (SSD1306) */
+      u8g_SetAddress(u8g, dev, 1);           /* data mode */
+      if ( u8g_WriteSequence(u8g, dev, fb->pb.width, ptr) == 0 )
+        return 0;
+      u8g_SetChipSelect(u8g, dev, 0);
+      u8g_pb_SetSumValid(&(fb->sum), page);
+    }
+    fb->dirty &= ~mask;
+    mask <<= 1;
+    ptr += fb->pb.width;
+  }
+  return 1;
+}
+
+uint8_t u8g_dev_ssd1306_128x64_fb_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+  switch(msg)
+  {
+    case U8G_DEV_MSG_INIT:
+      u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
+      u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
+      break;
+    case U8G_DEV_MSG_STOP:
+      break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      u8g_dev_ssd13xx_fb_check_lost(dev);
+      break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      if ( u8g_dev_ssd13xx_fb_write_dirty(u8g, dev, u8g_dev_ssd1306_128x64_data_start) == 0 )
+        return 0;
+      break;
+    case U8G_DEV_MSG_SLEEP_ON:
+      u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd13xx_sleep_on);    
+      return 1;
+    case U8G_DEV_MSG_SLEEP_OFF:
+      u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd13xx_sleep_off);    
+      return 1;
+  }
+  return u8g_dev_pb64v1_base_fn(u8g, dev, msg, arg);
+}
+
+uint8_t u8g_dev_sh1106_128x64_fb_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+  switch(msg)
+  {
+    case U8G_DEV_MSG_INIT:
+      u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
+      u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
+      break;
+    case U8G_DEV_MSG_STOP:
+      break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      u8g_dev_ssd13xx_fb_check_lost(dev);
+      break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      if ( u8g_dev_ssd13xx_fb_write_dirty(u8g, dev, u8g_dev_sh1106_128x64_data_start) == 0 )
+        return 0;
+      break;
+    case U8G_DEV_MSG_SLEEP_ON:
+      u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd13xx_sleep_on);    
+      return 1;
+    case U8G_DEV_MSG_SLEEP_OFF:
+      u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd13xx_sleep_off);    
+      return 1;
+  }
+  return u8g_dev_pb64v1_base_fn(u8g, dev, msg, arg);
+}
+
 
 
 U8G_PB_DEV(u8g_dev_ssd1306_128x64_sw_spi, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_ssd1306_128x64_fn, U8G_COM_SW_SPI);
@@ -399,6 +567,12 @@ u8g_dev_t u8g_dev_ssd1306_128x64_2x_sw_spi = { u8g_dev_ssd1306_128x64_2x_fn, &u8
 u8g_dev_t u8g_dev_ssd1306_128x64_2x_hw_spi = { u8g_dev_ssd1306_128x64_2x_fn, &u8g_dev_ssd1306_128x64_2x_pb, U8G_COM_HW_SPI };
 u8g_dev_t u8g_dev_ssd1306_128x64_2x_i2c = { u8g_dev_ssd1306_128x64_2x_fn, &u8g_dev_ssd1306_128x64_2x_pb, U8G_COM_SSD_I2C };
 
+uint8_t u8g_dev_ssd1306_128x64_fb_buf[WIDTH*HEIGHT/8] U8G_NOCOMMON ; 
+u8g_pb64v1_t u8g_dev_ssd1306_128x64_fb_pb = { { {HEIGHT, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1306_128x64_fb_buf}, 0x0ff, { 0, { 0 } } }; 
+u8g_dev_t u8g_dev_ssd1306_128x64_fb_sw_spi = { u8g_dev_ssd1306_128x64_fb_fn, &u8g_dev_ssd1306_128x64_fb_pb, U8G_COM_SW_SPI };
+u8g_dev_t u8g_dev_ssd1306_128x64_fb_hw_spi = { u8g_dev_ssd1306_128x64_fb_fn, &u8g_dev_ssd1306_128x64_fb_pb, U8G_COM_HW_SPI };
+u8g_dev_t u8g_dev_ssd1306_128x64_fb_i2c = { u8g_dev_ssd1306_128x64_fb_fn, &u8g_dev_ssd1306_128x64_fb_pb, U8G_COM_SSD_I2C };
+
 
 U8G_PB_DEV(u8g_dev_sh1106_128x64_sw_spi, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_sh1106_128x64_fn, U8G_COM_SW_SPI);
 U8G_PB_DEV(u8g_dev_sh1106_128x64_hw_spi, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_sh1106_128x64_fn, U8G_COM_HW_SPI);
@@ -410,3 +584,9 @@ u8g_dev_t u8g_dev_sh1106_128x64_2x_sw_spi = { u8g_dev_sh1106_128x64_2x_fn, &u8g_
 u8g_dev_t u8g_dev_sh1106_128x64_2x_hw_spi = { u8g_dev_sh1106_128x64_2x_fn, &u8g_dev_sh1106_128x64_2x_pb, U8G_COM_HW_SPI };
 u8g_dev_t u8g_dev_sh1106_128x64_2x_i2c = { u8g_dev_sh1106_128x64_2x_fn, &u8g_dev_sh1106_128x64_2x_pb, U8G_COM_SSD_I2C };
 
+uint8_t u8g_dev_sh1106_128x64_fb_buf[WIDTH*HEIGHT/8] U8G_NOCOMMON ; 
+u8g_pb64v1_t u8g_dev_sh1106_128x64_fb_pb = { { {HEIGHT, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_sh1106_128x64_fb_buf}, 0x0ff, { 0, { 0 } } }; 
+u8g_dev_t u8g_dev_sh1106_128x64_fb_sw_spi = { u8g_dev_sh1106_128x64_fb_fn, &u8g_dev_sh1106_128x64_fb_pb, U8G_COM_SW_SPI };
+u8g_dev_t u8g_dev_sh1106_128x64_fb_hw_spi = { u8g_dev_sh1106_128x64_fb_fn, &u8g_dev_sh1106_128x64_fb_pb, U8G_COM_HW_SPI };
+u8g_dev_t u8g_dev_sh1106_128x64_fb_i2c = { u8g_dev_sh1106_128x64_fb_fn, &u8g_dev_sh1106_128x64_fb_pb, U8G_COM_SSD_I2C };
+
@@ -0,0 +1,385 @@
+/*
+
+  u8g_dl.c
+  
+  display list: execute the draw code of the picture loop only once
+
+  If a display list is assigned (u8g_SetDisplayList), u8g_FirstPage() starts
+  to record the draw commands instead of executing them. During recording 
+  the current page covers the whole display. The following
+  u8g_NextPage() renders all pages from the recorded list and returns 0,
+  so the body of the picture loop is executed only once per frame.
+
+  Recorded: u8g_DrawStr, u8g_DrawStrP, u8g_DrawGlyph (print), u8g_DrawPixel,
+  u8g_DrawHLine, u8g_DrawVLine, u8g_DrawLine, u8g_DrawFrame, u8g_DrawBox,
+  u8g_DrawXBMP, u8g_DrawZBMP and u8g_DrawBitmapP. Consecutive glyphs on the same
+  baseline are merged into one glyph run. Strings and lines are culled 
+  against the current page before they are replayed.
+  
+  Any other procedure, which reaches the low level draw procedures while
+  recording, or an overflow of the buffer, cancels the recording: The
+  first page is cleared and the picture loop continues as usual.
+
+  Universal 8bit Graphics Library
+  
+  Copyright (c) 2011, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, 
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list 
+    of conditions and the following disclaimer.
+    
+  * Redistributions in binary form must reproduce the above copyright notice, this 
+    list of conditions and the following disclaimer in the documentation and/or other 
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT 
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  
+  
+
+*/
+
+#include "u8g.h"
+#include <string.h>
+
+#define U8G_DL_NO_RUN 0x0ffff
+
+void u8g_dl_Init(u8g_dl_t *dl, uint8_t *buf, uint16_t size)
+{
+  dl->buf = buf;
+  dl->size = size;
+  dl->len = 0;
+  dl->state = U8G_DL_STATE_OFF;
+}
+
+void u8g_SetDisplayList(u8g_t *u8g, u8g_dl_t *dl)
+{
+  u8g->dl = dl;
+}
+
+/* called by u8g_FirstPage() */
+void u8g_dl_Start(u8g_t *u8g)
+{
+  u8g_dl_t *dl = u8g->dl;
+  dl->len = 0;
+  dl->run = U8G_DL_NO_RUN;
+  dl->font = NULL;
+  dl->color = ~u8g->arg_pixel.color;		/* force COLOR command */
+  dl->state = U8G_DL_STATE_REC;
+  /* 
+    while recording, the page is the complete display: procedures which are 
+    not recorded must not skip their output because of the first page
+  */
+  u8g->current_page.y0 = 0;
+  u8g->current_page.y1 = u8g->height;
+  u8g->current_page.y1--;
+}
+
+/* called by the low level procedures: something has been drawn, which can not be recorded */
+void u8g_dl_Cancel(u8g_t *u8g)
+{
+  u8g->dl->state = U8G_DL_STATE_CANCEL;
+}
+
+static uint8_t *u8g_dl_alloc(u8g_t *u8g, uint16_t cnt)
+{
+  u8g_dl_t *dl = u8g->dl;
+  uint8_t *ptr;
+  if ( dl->size - dl->len < cnt )
+  {
+    u8g_dl_Cancel(u8g);
+    return NULL;
+  }
+  ptr = dl->buf + dl->len;
+  dl->len += cnt;
+  return ptr;
+}
+
+/* 
+  emit color and font commands, if they differ from the last recorded values 
+  the color command includes hi_color and blue for the 16 bit and true color modes
+*/
+static uint8_t u8g_dl_sync(u8g_t *u8g, uint8_t is_text)
+{
+  u8g_dl_t *dl = u8g->dl;
+  uint8_t *ptr;
+  if ( dl->color != u8g->arg_pixel.color || dl->hi_color != u8g->arg_pixel.hi_color || dl->blue != u8g->arg_pixel.blue )
+  {
+    ptr = u8g_dl_alloc(u8g, 4);
+    if ( ptr == NULL )
+      return 0;
+    ptr[0] = U8G_DL_OP_COLOR;
+    ptr[1] = u8g->arg_pixel.color;
+    ptr[2] = u8g->arg_pixel.hi_color;
+    ptr[3] = u8g->arg_pixel.blue;
+    dl->color = u8g->arg_pixel.color;
+    dl->hi_color = u8g->arg_pixel.hi_color;
+    dl->blue = u8g->arg_pixel.blue;
+    dl->run = U8G_DL_NO_RUN;
+  }
+  if ( is_text != 0 && dl->font != u8g->font )
+  {
+    ptr = u8g_dl_alloc(u8g, 1+sizeof(u8g->font));
+    if ( ptr == NULL )
+      return 0;
+    ptr[0] = U8G_DL_OP_FONT;
+    memcpy(ptr+1, &(u8g->font), sizeof(u8g->font));
+    dl->font = u8g->font;
+    dl->run = U8G_DL_NO_RUN;
+  }
+  return 1;
+}
+
+static uint8_t *u8g_dl_put_uint(uint8_t *ptr, u8g_uint_t v)
+{
+  memcpy(ptr, &v, sizeof(u8g_uint_t));
+  return ptr + sizeof(u8g_uint_t);
+}
+
+static const uint8_t *u8g_dl_get_uint(const uint8_t *ptr, u8g_uint_t *v)
+{
+  memcpy(v, ptr, sizeof(u8g_uint_t));
+  return ptr + sizeof(u8g_uint_t);
+}
+
+/* append one glyph to the current glyph run or start a new run, y is the baseline */
+static void u8g_dl_add_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding, int8_t dx)
+{
+  u8g_dl_t *dl = u8g->dl;
+  uint8_t *ptr;
+  
+  if ( dl->run != U8G_DL_NO_RUN && dl->run_x == x && dl->run_y == y && dl->buf[dl->run] != 255 )
+  {
+    ptr = u8g_dl_alloc(u8g, 1);
+    if ( ptr == NULL )
+      return;
+    *ptr = encoding;
+    dl->buf[dl->run]++;
+  }
+  else
+  {
+    ptr = u8g_dl_alloc(u8g, 1+2*sizeof(u8g_uint_t)+2);
+    if ( ptr == NULL )
+      return;
+    *ptr++ = U8G_DL_OP_STR;
+    ptr = u8g_dl_put_uint(ptr, x);
+    ptr = u8g_dl_put_uint(ptr, y);
+    dl->run = ptr - dl->buf;
+    *ptr++ = 1;
+    *ptr = encoding;
+    dl->run_y = y;
+  }
+  dl->run_x = x + dx;
+}
+
+int8_t u8g_dl_RecGlyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
+{
+  int8_t dx;
+  if ( u8g_dl_sync(u8g, 1) == 0 )
+    return 0;
+  dx = u8g_GetGlyphDeltaX(u8g, encoding);
+  y += u8g->font_calc_vref(u8g);
+  u8g_dl_add_glyph(u8g, x, y, encoding, dx);
+  return dx;
+}
+
+u8g_uint_t u8g_dl_RecStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s, uint8_t is_pgm)
+{
+  u8g_uint_t t = 0;
+  int8_t d;
+  uint8_t c;
+  
+  if ( u8g_dl_sync(u8g, 1) == 0 )
+    return 0;
+  y += u8g->font_calc_vref(u8g);
+  for(;;)
+  {
+    if ( is_pgm != 0 )
+      c = u8g_pgm_read((const u8g_pgm_uint8_t *)s);
+    else
+      c = *s;
+    if ( c == '\0' )
+      break;
+    d = u8g_GetGlyphDeltaX(u8g, c);
+    u8g_dl_add_glyph(u8g, x, y, c, d);
+    x += d;
+    t += d;
+    s++;
+  }
+  return t;
+}
+
+/* pixel, lines, frame and box: op with four arguments */
+void u8g_dl_RecBox(u8g_t *u8g, uint8_t op, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h)
+{
+  uint8_t *ptr;
+  if ( u8g_dl_sync(u8g, 0) == 0 )
+    return;
+  ptr = u8g_dl_alloc(u8g, 1+4*sizeof(u8g_uint_t));
+  if ( ptr == NULL )
+    return;
+  *ptr++ = op;
+  ptr = u8g_dl_put_uint(ptr, x);
+  ptr = u8g_dl_put_uint(ptr, y);
+  ptr = u8g_dl_put_uint(ptr, w);
+  u8g_dl_put_uint(ptr, h);
+  u8g->dl->run = U8G_DL_NO_RUN;
+}
+
+/* bitmaps in PROGMEM, only the pointer is stored */
+void u8g_dl_RecBitmap(u8g_t *u8g, uint8_t op, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap)
+{
+  uint8_t *ptr;
+  if ( u8g_dl_sync(u8g, 0) == 0 )
+    return;
+  ptr = u8g_dl_alloc(u8g, 1+4*sizeof(u8g_uint_t)+sizeof(bitmap));
+  if ( ptr == NULL )
+    return;
+  *ptr++ = op;
+  ptr = u8g_dl_put_uint(ptr, x);
+  ptr = u8g_dl_put_uint(ptr, y);
+  ptr = u8g_dl_put_uint(ptr, w);
+  ptr = u8g_dl_put_uint(ptr, h);
+  memcpy(ptr, &bitmap, sizeof(bitmap));
+  u8g->dl->run = U8G_DL_NO_RUN;
+}
+
+static void u8g_dl_replay(u8g_t *u8g, u8g_dl_t *dl)
+{
+  const uint8_t *ptr = dl->buf;
+  const uint8_t *end = dl->buf + dl->len;
+  const u8g_pgm_uint8_t *p;
+  u8g_uint_t x, y, w, h;
+  uint8_t op, cnt;
+  
+  while( ptr < end )
+  {
+    op = *ptr++;
+    switch(op)
+    {
+      case U8G_DL_OP_COLOR:
+        u8g->arg_pixel.color = *ptr++;
+        u8g->arg_pixel.hi_color = *ptr++;
+        u8g->arg_pixel.blue = *ptr++;
+        break;
+      case U8G_DL_OP_FONT:
+        memcpy(&p, ptr, sizeof(p));
+        ptr += sizeof(p);
+        u8g_SetFont(u8g, p);
+        break;
+      case U8G_DL_OP_STR:
+        ptr = u8g_dl_get_uint(ptr, &x);
+        ptr = u8g_dl_get_uint(ptr, &y);
+        cnt = *ptr++;
+        /* cull the complete run with the font bounding box */
+        h = u8g_GetFontBBXHeight(u8g);
+        w = y;
+        w -= u8g_GetFontBBXOffY(u8g);
+        w -= h;
+        if ( u8g_IsBBXIntersection(u8g, u8g->current_page.x0, w, 1, h) != 0 )
+        {
+          do
+          {
+            x += u8g_draw_glyph(u8g, x, y, *ptr++);
+            cnt--;
+          } while( cnt != 0 );
+        }
+        else
+        {
+          ptr += cnt;
+        }
+        break;
+      default:
+        ptr = u8g_dl_get_uint(ptr, &x);
+        ptr = u8g_dl_get_uint(ptr, &y);
+        ptr = u8g_dl_get_uint(ptr, &w);
+        ptr = u8g_dl_get_uint(ptr, &h);
+        switch(op)
+        {
+          case U8G_DL_OP_PIXEL:
+            u8g_DrawPixel(u8g, x, y);
+            break;
+          case U8G_DL_OP_HLINE:
+            u8g_DrawHLine(u8g, x, y, w);
+            break;
+          case U8G_DL_OP_VLINE:
+            u8g_DrawVLine(u8g, x, y, w);
+            break;
+          case U8G_DL_OP_LINE:
+            /* w, h are the second point */
+            if ( u8g_IsBBXIntersection(u8g, u8g->current_page.x0, y < h ? y : h, 1, (y < h ? h-y : y-h)+1) != 0 )
+              u8g_DrawLine(u8g, x, y, w, h);
+            break;
+          case U8G_DL_OP_FRAME:
+            u8g_DrawFrame(u8g, x, y, w, h);
+            break;
+          case U8G_DL_OP_BOX:
+            u8g_DrawBox(u8g, x, y, w, h);
+            break;
+          case U8G_DL_OP_XBMP:
+          case U8G_DL_OP_BITMAPP:
+          case U8G_DL_OP_ZBMP:
+            memcpy(&p, ptr, sizeof(p));
+            ptr += sizeof(p);
+            if ( op == U8G_DL_OP_XBMP )
+              u8g_DrawXBMP(u8g, x, y, w, h, p);
+            else if ( op == U8G_DL_OP_ZBMP )
+              u8g_DrawZBMP(u8g, x, y, p);
+            else
+              u8g_DrawBitmapP(u8g, x, y, w, h, p);
+            break;
+        }
+        break;
+    }
+  }
+}
+
+/* 
+  called by u8g_NextPage() at the end of the recording pass: render all pages and return 0 
+  or return 1 if the recording has been canceled: the draw code is executed for each page
+*/
+uint8_t u8g_dl_Render(u8g_t *u8g)
+{
+  u8g_dl_t *dl = u8g->dl;
+  const u8g_pgm_uint8_t *font = u8g->font;
+  uint8_t color = u8g->arg_pixel.color;
+  uint8_t hi_color = u8g->arg_pixel.hi_color;
+  uint8_t blue = u8g->arg_pixel.blue;
+  
+  if ( dl->state != U8G_DL_STATE_REC )
+  {
+    dl->state = U8G_DL_STATE_OFF;
+    u8g_FirstPageLL(u8g, u8g->dev);
+    return 1;
+  }
+  dl->state = U8G_DL_STATE_OFF;
+  u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_GET_PAGE_BOX, &(u8g->current_page));
+  do
+  {
+    u8g_dl_replay(u8g, dl);
+    if  ( u8g->cursor_fn != (u8g_draw_cursor_fn)0 )
+    {
+      u8g->cursor_fn(u8g);
+    }
+  } while( u8g_NextPageLL(u8g, u8g->dev) != 0 );
+  
+  /* restore the state of the end of the draw code */
+  u8g_SetFont(u8g, font);
+  u8g->arg_pixel.color = color;
+  u8g->arg_pixel.hi_color = hi_color;
+  u8g->arg_pixel.blue = blue;
+  return 0;
+}
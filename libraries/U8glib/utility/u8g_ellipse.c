@@ -98,11 +98,8 @@ void u8g_DrawEllipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t xr, u8
 
 #endif
 
-#if defined(U8G_16BIT)
+/* the error terms grow with rx*rx*ry: 16 bit overflow above a radius of about 20 */
 typedef  int32_t u8g_long_t;
-#else
-typedef  int16_t u8g_long_t;
-#endif
 
 
 /*
@@ -251,34 +248,6 @@ void u8g_DrawEllipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8
   u8g_draw_ellipse(u8g, x0, y0, rx, ry, option);
 }
 
-static void u8g_draw_filled_ellipse_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option) U8G_NOINLINE;
-static void u8g_draw_filled_ellipse_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option)
-{
-    /* upper right */
-    if ( option & U8G_DRAW_UPPER_RIGHT )
-    {
-      u8g_DrawVLine(u8g, x0+x, y0-y, y+1);
-    }
-    
-    /* upper left */
-    if ( option & U8G_DRAW_UPPER_LEFT )
-    {
-      u8g_DrawVLine(u8g, x0-x, y0-y, y+1);
-    }
-    
-    /* lower right */
-    if ( option & U8G_DRAW_LOWER_RIGHT )
-    {
-      u8g_DrawVLine(u8g, x0+x, y0, y+1);
-    }
-    
-    /* lower left */
-    if ( option & U8G_DRAW_LOWER_LEFT )
-    {
-      u8g_DrawVLine(u8g, x0-x, y0, y+1);
-    }
-}
-
 void u8g_draw_filled_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8g_uint_t ry, uint8_t option)
 {
   u8g_uint_t x, y;
@@ -287,6 +256,7 @@ void u8g_draw_filled_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_
   u8g_long_t rxrx2;
   u8g_long_t ryry2;
   u8g_long_t stopx, stopy;
+  u8g_uint_t y1;
   
   rxrx2 = rx;
   rxrx2 *= rx;
@@ -314,9 +284,13 @@ void u8g_draw_filled_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_
   stopx *= rx;
   stopy = 0;
   
+  /* horizontal spans (see u8g_draw_disc_span), one for each row y */
   while( stopx >= stopy )
   {
-    u8g_draw_filled_ellipse_section(u8g, x, y, x0, y0, option);
+    /* x or y out of range: the error terms have overflowed (U8G_16BIT with a very large radius) */
+    if ( x > rx || y > ry )
+      break;
+    u8g_draw_disc_span(u8g, x, y, x0, y0, option);
     y++;
     stopy += rxrx2;
     err += ychg;
@@ -330,6 +304,8 @@ void u8g_draw_filled_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_
     }
   }
 
+  y1 = y;		/* first row which has not been drawn */
+  
   x = 0;
   y = ry;
   
@@ -350,15 +326,18 @@ void u8g_draw_filled_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_
   stopy *= ry;
   
 
+  /* several points per row: the span ends at the last point (x-1) before y changes */
   while( stopx <= stopy )
   {
-    u8g_draw_filled_ellipse_section(u8g, x, y, x0, y0, option);
+    if ( x > rx || y > ry )
+      break;
     x++;
     stopx += ryry2;
     err += xchg;
     xchg += ryry2;
     if ( 2*err+ychg > 0 )
     {
+      u8g_draw_disc_span(u8g, x-1, y, x0, y0, option);
       y--;
       stopy -= rxrx2;
       err += ychg;
@@ -366,6 +345,21 @@ void u8g_draw_filled_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_
     }
   }
   
+  /* last row, also fill the rows which are not reached by the first loop (thin ellipses) */
+  /* y has wrapped around if ry is zero, nothing is left to do in this case */
+  if ( y > ry )
+    return;
+  if ( x > 0 )
+    x--;
+  if ( x > rx )
+    x = rx;
+  for(;;)
+  {
+    u8g_draw_disc_span(u8g, x, y, x0, y0, option);
+    if ( y <= y1 )
+      break;
+    y--;
+  }
 }
 
 void u8g_DrawFilledEllipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8g_uint_t ry, uint8_t option)
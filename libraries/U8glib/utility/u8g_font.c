@@ -64,6 +64,7 @@ typedef void * u8g_glyph_t;
   14            font min decent             negative: below baseline 
   15            font xascent
   16            font xdecent             negative: below baseline 
+  17            run length encoding             only format 4, see u8g_draw_rle_glyph_data()
   
 */
 
@@ -120,10 +121,20 @@ static uint8_t u8g_font_GetFontGlyphStructureSize(const u8g_fntpgm_uint8_t *font
     case 0: return 6;
     case 1: return 3;
     case 2: return 6;
+    case 3: return 6;
+    case 4: return 6;
   }
   return 3;
 }
 
+/* format 4 has one more byte of general information */
+static uint8_t u8g_font_GetFontDataStructSize(const u8g_fntpgm_uint8_t *font)
+{
+  if ( u8g_font_GetFormat(font) == 4 )
+    return U8G_FONT_DATA_STRUCT_SIZE+1;
+  return U8G_FONT_DATA_STRUCT_SIZE;
+}
+
 static uint8_t u8g_font_GetBBXWidth(const void *font)
 {
   return u8g_font_get_byte(font, 1);
@@ -219,7 +230,7 @@ size_t u8g_font_GetSize(const void *font)
   if ( font_format == 1 )
     mask = 15;
 
-  p += U8G_FONT_DATA_STRUCT_SIZE;       /* skip font general information */  
+  p += u8g_font_GetFontDataStructSize(font);       /* skip font general information */  
 
   i = start;  
   for(;;)
@@ -282,6 +293,8 @@ static void u8g_CopyGlyphDataToCache(u8g_t *u8g, u8g_glyph_t g)
   {
     case 0:
     case 2:
+    case 3:
+    case 4:
   /*
     format 0
     glyph information 
@@ -293,6 +306,10 @@ static void u8g_CopyGlyphDataToCache(u8g_t *u8g, u8g_glyph_t g)
     4             BBX xoffset                                    signed
     5             BBX yoffset                                    signed
   byte 0 == 255 indicates empty glyph
+    format 3: same glyph information, data size is BBX width * ((BBX height + 7)/8),
+    the bitmap is stored column by column, bit 0 of a byte is the upper pixel
+    format 4: same glyph information, data size is the number of bytes of the
+    run length encoded bitmap, see u8g_draw_rle_glyph_data()
   */
       u8g->glyph_width =  u8g_pgm_read( ((u8g_pgm_uint8_t *)g) + 0 );
       u8g->glyph_height =  u8g_pgm_read( ((u8g_pgm_uint8_t *)g) + 1 );
@@ -343,6 +360,70 @@ static void u8g_FillEmptyGlyphCache(u8g_t *u8g)
   u8g->glyph_y = 0;
 }
 
+/*========================================================================*/
+/* glyph index */
+
+/*
+  Build the glyph index for "font" in "buf" (cnt >= 1 entries).
+  Every (1<<shift)-th glyph gets an entry, shift is the smallest value
+  for which all encodings of the font fit into cnt entries.
+*/
+void u8g_font_index_Init(u8g_font_index_t *fi, const u8g_fntpgm_uint8_t *font, uint16_t *buf, uint8_t cnt)
+{
+  uint8_t *p = (uint8_t *)(font);
+  uint8_t data_structure_size = u8g_font_GetFontGlyphStructureSize(font);
+  uint8_t start, end;
+  uint8_t i, k;
+  uint8_t step_mask;
+  uint8_t mask = 255;
+  
+  if ( u8g_font_GetFormat(font) == 1 )
+    mask = 15;
+  
+  start = u8g_font_GetFontStartEncoding(font);
+  end = u8g_font_GetFontEndEncoding(font);
+  
+  fi->font = font;
+  fi->next = NULL;
+  fi->offset = buf;
+  fi->cnt = cnt;
+  fi->shift = 0;
+  while( fi->shift < 8 && (((uint16_t)(uint8_t)(end - start)) >> fi->shift) >= cnt )
+    fi->shift++;
+  step_mask = (1 << fi->shift) - 1;
+  
+  p += u8g_font_GetFontDataStructSize(font);       /* skip font general information */  
+  
+  i = start;
+  if ( i > end )
+    return;
+  for(;;)
+  {
+    k = i - start;
+    if ( (k & step_mask) == 0 )
+      buf[k >> fi->shift] = p - (uint8_t *)font;
+    if ( u8g_pgm_read((u8g_pgm_uint8_t *)(p)) == 255 )
+    {
+      p += 1;
+    }
+    else
+    {
+      p += u8g_pgm_read( ((u8g_pgm_uint8_t *)(p)) + 2 ) & mask;
+      p += data_structure_size;
+    }
+    if ( i == end )
+      break;
+    i++;
+  }
+}
+
+/* the index is used whenever its font is the current font */
+void u8g_AddFontIndex(u8g_t *u8g, u8g_font_index_t *fi)
+{
+  fi->next = u8g->font_index;
+  u8g->font_index = fi;
+}
+
 /*
   Find (with some speed optimization) and return a pointer to the glyph data structure
   Also uncompress (format 1) and copy the content of the data structure to the u8g structure
@@ -356,6 +437,7 @@ u8g_glyph_t u8g_GetGlyph(u8g_t *u8g, uint8_t requested_encoding)
   uint16_t pos;
   uint8_t i;
   uint8_t mask = 255;
+  u8g_font_index_t *fi;
 
   if ( font_format == 1 )
     mask = 15;
@@ -363,28 +445,44 @@ u8g_glyph_t u8g_GetGlyph(u8g_t *u8g, uint8_t requested_encoding)
   start = u8g_font_GetFontStartEncoding(u8g->font);
   end = u8g_font_GetFontEndEncoding(u8g->font);
 
-  pos = u8g_font_GetEncoding97Pos(u8g->font);
-  if ( requested_encoding >= 97 && pos > 0 )
+  if ( requested_encoding > end )
   {
-    p+= pos;
-    start = 97;
+    u8g_FillEmptyGlyphCache(u8g);
+    return NULL;                      /* not found */
   }
-  else 
+  
+  for( fi = u8g->font_index; fi != NULL; fi = fi->next )
+    if ( fi->font == u8g->font )
+      break;
+  
+  if ( fi != NULL && requested_encoding >= start )
+  {
+    /* start at the nearest indexed glyph, no search at all if shift is 0 */
+    i = requested_encoding - start;
+    i >>= fi->shift;
+    p += fi->offset[i];
+    i <<= fi->shift;
+    start += i;
+  }
+  else
   {
-    pos = u8g_font_GetEncoding65Pos(u8g->font);
-    if ( requested_encoding >= 65 && pos > 0 )
+    pos = u8g_font_GetEncoding97Pos(u8g->font);
+    if ( requested_encoding >= 97 && pos > 0 )
     {
       p+= pos;
-      start = 65;
+      start = 97;
+    }
+    else 
+    {
+      pos = u8g_font_GetEncoding65Pos(u8g->font);
+      if ( requested_encoding >= 65 && pos > 0 )
+      {
+        p+= pos;
+        start = 65;
+      }
+      else
+        p += u8g_font_GetFontDataStructSize(u8g->font);       /* skip font general information */  
     }
-    else
-      p += U8G_FONT_DATA_STRUCT_SIZE;       /* skip font general information */  
-  }
-  
-  if ( requested_encoding > end )
-  {
-    u8g_FillEmptyGlyphCache(u8g);
-    return NULL;                      /* not found */
   }
   
   i = start;
@@ -561,6 +659,199 @@ int8_t u8g_DrawGlyphDir(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uin
 }
 #endif
 
+/*
+  Draw the column major bitmap of a format 3 glyph.
+  x,y: position of the upper left pixel of the glyph, dir: direction of the glyph rows
+  Each byte covers 8 pixel of a column, it is drawn from the lowest pixel upwards.
+*/
+static void u8g_draw_vglyph_data(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, const u8g_pgm_uint8_t *data, uint8_t w, uint8_t h)
+{
+  u8g_uint_t cx = 0, cy = 0, rx = 0, ry = 0;
+  u8g_uint_t ix, iy;
+  uint8_t i, j;
+  
+  switch(dir)
+  {
+    case 0: cx = 1; ry = 1; break;
+    case 1: cy = 1; rx = -1; break;
+    case 2: cx = -1; ry = -1; break;
+    case 3: cy = -1; rx = 1; break;
+  }
+  
+  h += 7;
+  h /= 8;
+  
+  for( i = 0; i < w; i++ )
+  {
+    ix = x + 7*rx;
+    iy = y + 7*ry;
+    for( j = 0; j < h; j++ )
+    {
+      u8g_Draw8Pixel(u8g, ix, iy, (dir+3)&3, u8g_pgm_read(data));
+      data++;
+      ix += 8*rx;
+      iy += 8*ry;
+    }
+    x += cx;
+    y += cy;
+  }
+}
+
+/*
+  Draw the run length encoded bitmap of a format 4 glyph.
+  
+  The pixel of the glyph are taken row by row (w pixel per row, no padding)
+  as a sequence of pairs: a run of 0 pixel followed by a run of 1 pixel.
+  Byte 17 of the font information describes the encoding:
+    bit 0..2    number of bits for the length of a 0 run (1..7)
+    bit 3..5    number of bits for the length of a 1 run (1..7)
+    bit 6       a repeat flag follows each pair, as long as this flag is 1, 
+                the previous pair is used again
+  The bits are read from the lowest bit of each byte upwards. Trailing 0 pixel
+  of a glyph are not stored.
+  The runs are collected into 8 pixel spans which are written with 
+  u8g_Draw8Pixel(), spans without any set pixel are skipped.
+  x,y: position of the upper left pixel of the glyph, dir: direction of the glyph rows
+  The decoder is compiled only with U8G_WITH_RLE_FONT, otherwise the glyphs of a 
+  format 4 font are not drawn.
+*/
+#ifdef U8G_WITH_RLE_FONT
+
+struct _u8g_rle_glyph_t
+{
+  const u8g_pgm_uint8_t *data;
+  uint16_t bits_left;
+  uint8_t val;				/* current data byte */
+  uint8_t pos;				/* number of used bits of val */
+  u8g_uint_t ox, oy;			/* position of the current 8 pixel span */
+  u8g_uint_t rx, ry;			/* position of the current row */
+  u8g_uint_t cx, cy;			/* step to the next pixel in a row */
+  u8g_uint_t nx, ny;			/* step to the next row */
+  uint8_t w, col, rows_left;
+  uint8_t pixel, bit;			/* current span and number of pixel in it */
+  uint8_t dir;
+};
+typedef struct _u8g_rle_glyph_t u8g_rle_glyph_t;
+
+static uint8_t u8g_rle_get_bits(u8g_rle_glyph_t *r, uint8_t cnt)
+{
+  uint8_t val = r->val >> r->pos;
+  r->pos += cnt;
+  if ( r->pos > 8 )
+  {
+    r->pos -= 8;
+    r->data++;
+    r->val = u8g_pgm_read(r->data);
+    val |= r->val << (cnt - r->pos);
+  }
+  r->bits_left -= cnt;
+  return val & ((1 << cnt) - 1);
+}
+
+static void u8g_rle_flush(u8g_t *u8g, u8g_rle_glyph_t *r)
+{
+  if ( r->pixel != 0 )
+    u8g_Draw8Pixel(u8g, r->ox, r->oy, r->dir, r->pixel);
+  r->pixel = 0;
+  r->bit = 0;
+}
+
+/* add cnt pixel to the glyph, returns 0 if the last row is complete */
+static uint8_t u8g_rle_put(u8g_t *u8g, u8g_rle_glyph_t *r, uint8_t cnt, uint8_t is_set)
+{
+  uint8_t k;
+  while( cnt > 0 )
+  {
+    /* number of pixel which go into the current span */
+    k = 8 - r->bit;
+    if ( k > r->w - r->col )
+      k = r->w - r->col;
+    if ( k > cnt )
+      k = cnt;
+    if ( is_set )
+      r->pixel |= (uint8_t)(0x0ff >> r->bit) ^ (uint8_t)(0x0ff >> (r->bit + k));
+    r->bit += k;
+    r->col += k;
+    cnt -= k;
+    if ( r->col == r->w )
+    {
+      u8g_rle_flush(u8g, r);
+      r->rows_left--;
+      if ( r->rows_left == 0 )
+        return 0;
+      r->col = 0;
+      r->rx += r->nx;
+      r->ry += r->ny;
+      r->ox = r->rx;
+      r->oy = r->ry;
+    }
+    else if ( r->bit == 8 )
+    {
+      u8g_rle_flush(u8g, r);
+      r->ox += r->cx*8;
+      r->oy += r->cy*8;
+    }
+  }
+  return 1;
+}
+
+static void u8g_draw_rle_glyph_data(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, const u8g_pgm_uint8_t *data, uint8_t w, uint8_t h)
+{
+  u8g_rle_glyph_t r;
+  uint8_t rle, bits0, bits1, len0, len1;
+  
+  if ( w == 0 || h == 0 )
+    return;
+  
+  r.cx = 0; r.cy = 0; r.nx = 0; r.ny = 0;
+  switch(dir)
+  {
+    case 0: r.cx = 1; r.ny = 1; break;
+    case 1: r.cy = 1; r.nx = -1; break;
+    case 2: r.cx = -1; r.ny = -1; break;
+    case 3: r.cy = -1; r.nx = 1; break;
+  }
+  r.dir = dir;
+  r.rx = x; r.ry = y;
+  r.ox = x; r.oy = y;
+  r.w = w;
+  r.col = 0;
+  r.rows_left = h;
+  r.pixel = 0;
+  r.bit = 0;
+  
+  rle = u8g_font_get_byte(u8g->font, 17);
+  bits0 = rle & 7;
+  bits1 = (rle >> 3) & 7;
+  r.bits_left = u8g_pgm_read(data-4);		/* data size of the glyph */
+  if ( r.bits_left == 0 )
+    return;
+  r.bits_left *= 8;
+  r.data = data;
+  r.val = u8g_pgm_read(data);
+  r.pos = 0;
+  
+  while( r.bits_left >= bits0 + bits1 )
+  {
+    len0 = u8g_rle_get_bits(&r, bits0);
+    len1 = u8g_rle_get_bits(&r, bits1);
+    for(;;)
+    {
+      if ( u8g_rle_put(u8g, &r, len0, 0) == 0 )
+        return;
+      if ( u8g_rle_put(u8g, &r, len1, 1) == 0 )
+        return;
+      if ( (rle & 64) == 0 || r.bits_left == 0 )
+        break;
+      if ( u8g_rle_get_bits(&r, 1) == 0 )
+        break;
+    }
+  }
+  /* the remaining pixel are 0 */
+  u8g_rle_flush(u8g, &r);
+}
+#endif /* U8G_WITH_RLE_FONT */
+
 int8_t u8g_draw_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
 {
   const u8g_pgm_uint8_t *data;
@@ -585,14 +876,29 @@ int8_t u8g_draw_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
   if ( u8g_IsBBXIntersection(u8g, x, y-h+1, w, h) == 0 )
     return u8g->glyph_dx;
 
-  /* now, w is reused as bytes per line */
-  w += 7;
-  w /= 8;
-  
   iy = y;
   iy -= h;
   iy++;
 
+  if ( u8g_font_GetFormat(u8g->font) == 3 )
+  {
+    /* page buffers with vertical bytes take the glyph as it is */
+    if ( u8g_DrawVGlyphLL(u8g, u8g->dev, x, iy, w, h, data) == 0 )
+      u8g_draw_vglyph_data(u8g, x, iy, 0, data, w, h);
+    return u8g->glyph_dx;
+  }
+  if ( u8g_font_GetFormat(u8g->font) == 4 )
+  {
+#ifdef U8G_WITH_RLE_FONT
+    u8g_draw_rle_glyph_data(u8g, x, iy, 0, data, w, h);
+#endif
+    return u8g->glyph_dx;
+  }
+  
+  /* now, w is reused as bytes per line */
+  w += 7;
+  w /= 8;
+  
   for( j = 0; j < h; j++ )
   {
     ix = x;
@@ -609,6 +915,8 @@ int8_t u8g_draw_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
 
 int8_t u8g_DrawGlyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
 {
+  if ( u8g_dl_IsRec(u8g) )
+    return u8g_dl_RecGlyph(u8g, x, y, encoding);
   y += u8g->font_calc_vref(u8g);
   return u8g_draw_glyph(u8g, x, y, encoding);
 }
@@ -637,6 +945,19 @@ int8_t u8g_draw_glyph90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding
   if ( u8g_IsBBXIntersection(u8g, x, y, h, w) == 0 )
     return u8g->glyph_dx;
 
+  if ( u8g_font_GetFormat(u8g->font) == 3 )
+  {
+    u8g_draw_vglyph_data(u8g, x+h-1, y, 1, data, w, h);
+    return u8g->glyph_dx;
+  }
+  if ( u8g_font_GetFormat(u8g->font) == 4 )
+  {
+#ifdef U8G_WITH_RLE_FONT
+    u8g_draw_rle_glyph_data(u8g, x+h-1, y, 1, data, w, h);
+#endif
+    return u8g->glyph_dx;
+  }
+  
   /* now, w is reused as bytes per line */
   w += 7;
   w /= 8;
@@ -689,6 +1010,19 @@ int8_t u8g_draw_glyph180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encodin
   if ( u8g_IsBBXIntersection(u8g, x-(w-1), y, w, h) == 0 )
     return u8g->glyph_dx;
 
+  if ( u8g_font_GetFormat(u8g->font) == 3 )
+  {
+    u8g_draw_vglyph_data(u8g, x, y+h-1, 2, data, w, h);
+    return u8g->glyph_dx;
+  }
+  if ( u8g_font_GetFormat(u8g->font) == 4 )
+  {
+#ifdef U8G_WITH_RLE_FONT
+    u8g_draw_rle_glyph_data(u8g, x, y+h-1, 2, data, w, h);
+#endif
+    return u8g->glyph_dx;
+  }
+  
   /* now, w is reused as bytes per line */
   w += 7;
   w /= 8;
@@ -741,6 +1075,18 @@ int8_t u8g_draw_glyph270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encodin
   if ( u8g_IsBBXIntersection(u8g, x-(h-1), y-(w-1), h, w) == 0 )
     return u8g->glyph_dx;
   
+  if ( u8g_font_GetFormat(u8g->font) == 3 )
+  {
+    u8g_draw_vglyph_data(u8g, x-(h-1), y, 3, data, w, h);
+    return u8g->glyph_dx;
+  }
+  if ( u8g_font_GetFormat(u8g->font) == 4 )
+  {
+#ifdef U8G_WITH_RLE_FONT
+    u8g_draw_rle_glyph_data(u8g, x-(h-1), y, 3, data, w, h);
+#endif
+    return u8g->glyph_dx;
+  }
 
   /* now, w is reused as bytes per line */
   w += 7;
@@ -798,6 +1144,9 @@ u8g_uint_t u8g_DrawStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s)
   //u8g_uint_t u8g_GetStrWidth(u8g, s);
   //u8g_font_GetFontAscent(u8g->font)-u8g_font_GetFontDescent(u8g->font);
   
+  if ( u8g_dl_IsRec(u8g) )
+    return u8g_dl_RecStr(u8g, x, y, s, 0);
+  
   y += u8g->font_calc_vref(u8g);
   
   while( *s != '\0' )
@@ -883,6 +1232,9 @@ u8g_uint_t u8g_DrawStrP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_ui
   int8_t d;
   uint8_t c;
   
+  if ( u8g_dl_IsRec(u8g) )
+    return u8g_dl_RecStr(u8g, x, y, (const char *)s, 1);
+  
   y += u8g->font_calc_vref(u8g);
   
   for(;;)
@@ -1208,6 +1560,9 @@ u8g_uint_t u8g_GetStrWidth(u8g_t *u8g, const char *s)
   u8g_uint_t  w;
   uint8_t encoding;
   
+  if ( u8g->str_cache != NULL )
+    return u8g_GetStrSize(u8g, s, NULL, NULL);
+  
   /* reset the total width to zero, this will be expanded during calculation */
   w = 0;
   
@@ -1234,6 +1589,9 @@ u8g_uint_t u8g_GetStrWidthP(u8g_t *u8g, const u8g_pgm_uint8_t *s)
   u8g_uint_t  w;
   uint8_t encoding;
   
+  if ( u8g->str_cache != NULL )
+    return u8g_GetStrSizeP(u8g, s, NULL, NULL);
+  
   /* reset the total width to zero, this will be expanded during calculation */
   w = 0;
   
@@ -1255,6 +1613,154 @@ u8g_uint_t u8g_GetStrWidthP(u8g_t *u8g, const u8g_pgm_uint8_t *s)
 }
 
 
+/*========================================================================*/
+/* string size cache */
+
+/*
+  Width (sum of DWIDTH, same as u8g_GetStrWidth), ascent and descent of a
+  string. PROGMEM strings are identified by their address. Strings in RAM
+  are compared with a copy of their characters, because the buffer may be
+  reused for another text; strings longer than U8G_SC_STR_LEN are always
+  measured. The entries are kept in most recently used order, so a hit 
+  moves the entry to the front and a miss replaces the last one.
+*/
+
+void u8g_sc_Init(u8g_sc_t *sc, u8g_sc_entry_t *buf, uint8_t cnt)
+{
+  sc->entry = buf;
+  sc->cnt = cnt;
+  sc->used = 0;
+}
+
+void u8g_SetStrCache(u8g_t *u8g, u8g_sc_t *sc)
+{
+  u8g->str_cache = sc;
+}
+
+static void u8g_font_calc_str_size(u8g_t *u8g, const char *s, u8g_font_get_char_fn get_char, u8g_sc_entry_t *e)
+{
+  uint8_t enc;
+  int8_t tmp;
+  
+  e->width = 0;
+  e->ascent = 0;
+  e->descent = 0;
+  
+  /* empty string */
+  if ( get_char(s) == '\0' )
+    return;
+  
+  e->ascent = -128;
+  e->descent = 127;
+  for(;;)
+  {
+    enc = get_char(s);
+    if ( enc == '\0' )
+      break;
+    u8g_GetGlyph(u8g, enc);
+    e->width += u8g->glyph_dx;
+    tmp = u8g->glyph_y;
+    if ( e->descent > tmp )
+      e->descent = tmp;
+    tmp += u8g->glyph_height;
+    if ( e->ascent < tmp )
+      e->ascent = tmp;
+    s++;
+  }
+}
+
+/* returns NULL if the string can not be cached */
+static u8g_sc_entry_t *u8g_sc_get(u8g_t *u8g, const char *s, u8g_font_get_char_fn get_char, uint8_t is_pgm)
+{
+  u8g_sc_t *sc = u8g->str_cache;
+  u8g_sc_entry_t tmp;
+  u8g_sc_entry_t *e;
+  uint8_t i, j;
+  
+  tmp.font = u8g->font;
+  tmp.s = NULL;
+  tmp.len = 0;
+  if ( is_pgm != 0 )
+  {
+    tmp.s = s;
+  }
+  else
+  {
+    while( s[tmp.len] != '\0' )
+    {
+      if ( tmp.len >= U8G_SC_STR_LEN )
+        return NULL;
+      tmp.str[tmp.len] = s[tmp.len];
+      tmp.len++;
+    }
+  }
+  
+  for( i = 0; i < sc->used; i++ )
+  {
+    e = sc->entry + i;
+    if ( e->font == tmp.font && e->s == tmp.s && e->len == tmp.len )
+    {
+      for( j = 0; j < tmp.len; j++ )
+        if ( e->str[j] != tmp.str[j] )
+          break;
+      if ( j == tmp.len )
+      {
+        tmp = *e;
+        break;
+      }
+    }
+  }
+  
+  if ( i == sc->used )
+  {
+    /* not found: measure the string, the last entry gets replaced */
+    u8g_font_calc_str_size(u8g, s, get_char, &tmp);
+    if ( sc->used < sc->cnt )
+      sc->used++;
+    i = sc->used - 1;
+  }
+  
+  /* move the entry to the front */
+  e = sc->entry;
+  while( i > 0 )
+  {
+    e[i] = e[i-1];
+    i--;
+  }
+  e[0] = tmp;
+  return e;
+}
+
+static u8g_uint_t u8g_font_get_str_size(u8g_t *u8g, const char *s, u8g_font_get_char_fn get_char, uint8_t is_pgm, int8_t *ascent, int8_t *descent)
+{
+  u8g_sc_entry_t tmp;
+  u8g_sc_entry_t *e = NULL;
+  
+  if ( u8g->str_cache != NULL && u8g->str_cache->cnt > 0 )
+    e = u8g_sc_get(u8g, s, get_char, is_pgm);
+  if ( e == NULL )
+  {
+    e = &tmp;
+    u8g_font_calc_str_size(u8g, s, get_char, e);
+  }
+  
+  if ( ascent != NULL )
+    *ascent = e->ascent;
+  if ( descent != NULL )
+    *descent = e->descent;
+  return e->width;
+}
+
+u8g_uint_t u8g_GetStrSize(u8g_t *u8g, const char *s, int8_t *ascent, int8_t *descent)
+{
+  return u8g_font_get_str_size(u8g, s, u8g_font_get_char, 0, ascent, descent);
+}
+
+u8g_uint_t u8g_GetStrSizeP(u8g_t *u8g, const u8g_pgm_uint8_t *s, int8_t *ascent, int8_t *descent)
+{
+  return u8g_font_get_str_size(u8g, (const char *)s, u8g_font_get_charP, 1, ascent, descent);
+}
+
 /*========================================================================*/
 /* calculation of font/glyph/string characteristics */
 
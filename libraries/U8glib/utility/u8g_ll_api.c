@@ -87,6 +87,8 @@ uint8_t u8g_SetContrastLL(u8g_t *u8g, u8g_dev_t *dev, uint8_t contrast)
 void u8g_DrawPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y)
 {
   u8g_dev_arg_pixel_t *arg = &(u8g->arg_pixel);
+  if ( u8g_dl_IsRec(u8g) )
+    u8g_dl_Cancel(u8g);
   arg->x = x;
   arg->y = y;
   u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_PIXEL, arg);
@@ -95,6 +97,8 @@ void u8g_DrawPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y)
 void u8g_Draw8PixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel)
 {
   u8g_dev_arg_pixel_t *arg = &(u8g->arg_pixel);
+  if ( u8g_dl_IsRec(u8g) )
+    u8g_dl_Cancel(u8g);
   arg->x = x;
   arg->y = y;
   arg->dir = dir;
@@ -102,9 +106,42 @@ void u8g_Draw8PixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, ui
   u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_8PIXEL, arg);
 }
 
+uint8_t u8g_DrawBoxLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h)
+{
+  u8g_dev_arg_box_t arg;
+  if ( u8g_dl_IsRec(u8g) )
+    u8g_dl_Cancel(u8g);
+  arg.x = x;
+  arg.y = y;
+  arg.w = w;
+  arg.h = h;
+  arg.color = u8g->arg_pixel.color;
+  arg.is_done = 0;
+  u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_BOX, &arg);
+  return arg.is_done;
+}
+
+uint8_t u8g_DrawVGlyphLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, uint8_t w, uint8_t h, const u8g_pgm_uint8_t *data)
+{
+  u8g_dev_arg_vglyph_t arg;
+  if ( u8g_dl_IsRec(u8g) )
+    u8g_dl_Cancel(u8g);
+  arg.x = x;
+  arg.y = y;
+  arg.w = w;
+  arg.h = h;
+  arg.data = data;
+  arg.color = u8g->arg_pixel.color;
+  arg.is_done = 0;
+  u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_VGLYPH, &arg);
+  return arg.is_done;
+}
+
 void u8g_Draw4TPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel)
 {
   u8g_dev_arg_pixel_t *arg = &(u8g->arg_pixel);
+  if ( u8g_dl_IsRec(u8g) )
+    u8g_dl_Cancel(u8g);
   arg->x = x;
   arg->y = y;
   arg->dir = dir;
@@ -183,6 +220,9 @@ static void u8g_init_data(u8g_t *u8g)
   
   u8g->state_cb = u8g_state_dummy_cb;
 
+  u8g->dl = NULL;
+  u8g->font_index = NULL;
+  u8g->str_cache = NULL;
 }
 
 uint8_t u8g_Begin(u8g_t *u8g)
@@ -383,10 +423,14 @@ uint8_t u8g_InitRW8Bit(u8g_t *u8g, u8g_dev_t *dev, uint8_t d0, uint8_t d1, uint8
 void u8g_FirstPage(u8g_t *u8g)
 {
   u8g_FirstPageLL(u8g, u8g->dev);
+  if ( u8g->dl != NULL )
+    u8g_dl_Start(u8g);
 }
 
 uint8_t u8g_NextPage(u8g_t *u8g)
 {
+  if ( u8g->dl != NULL && u8g->dl->state != U8G_DL_STATE_OFF )
+    return u8g_dl_Render(u8g);
   if  ( u8g->cursor_fn != (u8g_draw_cursor_fn)0 )
   {
     u8g->cursor_fn(u8g);
@@ -412,6 +456,11 @@ void u8g_SleepOff(u8g_t *u8g)
 
 void u8g_DrawPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y)
 {
+  if ( u8g_dl_IsRec(u8g) )
+  {
+    u8g_dl_RecBox(u8g, U8G_DL_OP_PIXEL, x, y, 1, 1);
+    return;
+  }
   u8g_DrawPixelLL(u8g, u8g->dev, x, y);
 }
 
@@ -428,6 +477,8 @@ void u8g_Draw4TPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_
 void u8g_Draw8ColorPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t colpixel)
 {
   u8g_dev_arg_pixel_t *arg = &(u8g->arg_pixel);
+  if ( u8g_dl_IsRec(u8g) )
+    u8g_dl_Cancel(u8g);
   arg->x = x;
   arg->y = y;
   arg->dir = 0;
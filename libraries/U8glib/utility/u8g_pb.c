@@ -37,6 +37,7 @@
 */
 
 #include "u8g.h"
+#include <string.h>
 
 void u8g_pb_Clear(u8g_pb_t *b)
 {
@@ -183,9 +184,218 @@ uint8_t u8g_pb_Is8PixelVisible(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel)
 }
 
 
+/*
+  Clip the span v, v+1, ..., v+len-1 to 0..lim-1. Like the pixel positions, the
+  span is calculated modulo the range of u8g_uint_t.
+  return 0: nothing visible, 1: visible part is returned in v and len, 
+  2: two parts are visible, because the span wraps around
+*/
+static uint8_t u8g_pb_clip_span(u8g_uint_t *v, u8g_uint_t *len, u8g_uint_t lim)
+{
+  u8g_uint_t end;
+  
+  if ( *len == 0 )
+    return 0;
+  end = *v;
+  end += *len;
+  if ( *v < lim )
+  {
+    if ( end < *v )
+    {
+      if ( end != 0 )
+        return 2;
+      *len = lim - *v;
+    }
+    else if ( end > lim )
+    {
+      *len = lim - *v;
+    }
+    return 1;
+  }
+  if ( end < *v && end != 0 )
+  {
+    *v = 0;
+    *len = end < lim ? end : lim;
+    return 1;
+  }
+  return 0;
+}
+
+/* clip the box to the page, y becomes relative to the page, returns 0 if there is nothing to draw */
+static uint8_t u8g_pb_clip_box(u8g_pb_t *b, u8g_dev_arg_box_t *arg)
+{
+  uint8_t cx, cy;
+  
+  arg->y -= b->p.page_y0;
+  cx = u8g_pb_clip_span(&(arg->x), &(arg->w), b->width);
+  cy = u8g_pb_clip_span(&(arg->y), &(arg->h), b->p.page_y1 - b->p.page_y0 + 1);
+  if ( cx == 0 || cy == 0 )
+  {
+    arg->is_done = 1;
+    return 0;
+  }
+  if ( cx == 2 || cy == 2 )
+    return 0;		/* let the procedure draw it pixel by pixel */
+  arg->is_done = 1;
+  return 1;
+}
+
+/* fill a box in a page buffer with vertical bytes (pb8v1, pb16v1) */
+void u8g_pb_SetBoxV1(u8g_pb_t *b, u8g_dev_arg_box_t *arg)
+{
+  uint8_t *ptr;
+  uint8_t mask;
+  uint8_t n;
+  u8g_uint_t y, h, i;
+  
+  if ( u8g_pb_clip_box(b, arg) == 0 )
+    return;
+  
+  y = arg->y;
+  h = arg->h;
+  while( h != 0 )
+  {
+    ptr = b->buf;
+    ptr += (y >> 3) * b->width;
+    ptr += arg->x;
+    
+    /* rows y..y+n-1 of this byte */
+    mask = 0x0ff << (y & 7);
+    n = 8 - (y & 7);
+    if ( h < n )
+    {
+      mask &= 0x0ff >> (n - h);
+      n = h;
+    }
+    
+    i = arg->w;
+    if ( arg->color )
+    {
+      do
+      {
+        *ptr++ |= mask;
+        i--;
+      } while( i != 0 );
+    }
+    else
+    {
+      mask ^= 0x0ff;
+      do
+      {
+        *ptr++ &= mask;
+        i--;
+      } while( i != 0 );
+    }
+    y += n;
+    h -= n;
+  }
+}
+
+/* fill a box in a page buffer with horizontal bytes (pb8h1, pb16h1, pb32h1) */
+void u8g_pb_SetBoxH1(u8g_pb_t *b, u8g_dev_arg_box_t *arg)
+{
+  uint8_t *ptr;
+  uint8_t lmask, rmask;
+  u8g_uint_t bytes_per_row = b->width >> 3;
+  u8g_uint_t x1, cnt, h;
+  
+  if ( u8g_pb_clip_box(b, arg) == 0 )
+    return;
+  
+  x1 = arg->x;
+  x1 += arg->w;
+  x1--;
+  lmask = 0x0ff >> (arg->x & 7);
+  rmask = 0x0ff << (7 - (x1 & 7));
+  cnt = (x1 >> 3) - (arg->x >> 3);		/* number of bytes after the first byte */
+  if ( cnt == 0 )
+    lmask &= rmask;
+  
+  ptr = b->buf;
+  ptr += (uint16_t)arg->y * bytes_per_row;
+  ptr += arg->x >> 3;
+  h = arg->h;
+  do
+  {
+    if ( arg->color )
+    {
+      ptr[0] |= lmask;
+      if ( cnt != 0 )
+      {
+        memset(ptr+1, 0x0ff, cnt-1);
+        ptr[cnt] |= rmask;
+      }
+    }
+    else
+    {
+      ptr[0] &= ~lmask;
+      if ( cnt != 0 )
+      {
+        memset(ptr+1, 0, cnt-1);
+        ptr[cnt] &= ~rmask;
+      }
+    }
+    ptr += bytes_per_row;
+    h--;
+  } while( h != 0 );
+}
 
 uint8_t u8g_pb_WriteBuffer(u8g_pb_t *b, u8g_t *u8g, u8g_dev_t *dev)
 {
   return u8g_WriteSequence(u8g, dev, b->width, b->buf);  
 }
 
+/*
+  The display keeps its RAM content, so a page which is equal to the one of the
+  previous picture loop does not need to be transfered again. A CRC-16 (CCITT)
+  of the page is stored for each of the 8 controller pages. A simple fletcher
+  sum is not sufficient: it does not detect an object which moves horizontally.
+  The checksum of a page becomes valid with u8g_pb_SetSumValid(), which must be 
+  called after the page has been transfered: if the transfer fails, the page 
+  is sent again by the next picture loop.
+*/
+void u8g_pb_ResetSum(u8g_pb_sum_t *sum)
+{
+  sum->valid = 0;
+}
+
+/* returns 0 if "cnt" bytes at "buf" are equal to the last content of "page", otherwise the new checksum is stored (but not yet valid) */
+uint8_t u8g_pb_IsChanged(u8g_pb_sum_t *sum, uint8_t page, uint8_t cnt, const uint8_t *buf)
+{
+  uint16_t crc = 0x0ffff;
+  uint8_t x;
+  uint8_t mask;
+  
+  if ( page >= U8G_PB_SUM_PAGES )
+    return 1;
+  do
+  {
+    x = crc >> 8;
+    x ^= *buf++;
+    x ^= x >> 4;
+    crc <<= 8;
+    crc ^= ((uint16_t)x) << 12;
+    crc ^= ((uint16_t)x) << 5;
+    crc ^= x;
+    cnt--;
+  } while( cnt != 0 );
+  
+  mask = 1;
+  mask <<= page;
+  if ( (sum->valid & mask) != 0 && sum->sum[page] == crc )
+    return 0;
+  sum->sum[page] = crc;
+  sum->valid &= ~mask;
+  return 1;
+}
+
+/* the page, for which u8g_pb_IsChanged() has stored the checksum, has been transfered to the display */
+void u8g_pb_SetSumValid(u8g_pb_sum_t *sum, uint8_t page)
+{
+  uint8_t mask;
+  if ( page >= U8G_PB_SUM_PAGES )
+    return;
+  mask = 1;
+  mask <<= page;
+  sum->valid |= mask;
+}
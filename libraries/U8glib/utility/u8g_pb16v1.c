@@ -161,6 +161,9 @@ uint8_t u8g_dev_pb16v1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
     case U8G_DEV_MSG_SET_PIXEL:
         u8g_pb16v1_SetPixel(pb, (u8g_dev_arg_pixel_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_BOX:
+      u8g_pb_SetBoxV1(pb, (u8g_dev_arg_box_t *)arg);
+      break;
     case U8G_DEV_MSG_INIT:
       break;
     case U8G_DEV_MSG_STOP:
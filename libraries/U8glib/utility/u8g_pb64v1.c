@@ -0,0 +1,193 @@
+/*
+
+  u8g_pb64v1.c
+  
+  64bit height monochrom (1 bit) full frame buffer
+  byte has vertical orientation
+
+  The frame is drawn in a single pass of the picture loop and is kept
+  between picture loops: PAGE_FIRST does not clear the buffer. Only the
+  parts of the picture which have changed need to be redrawn (use color
+  index 0 to erase). Each write which really modifies a byte marks the
+  corresponding 8 pixel row (the controller page) in the dirty bitmap.
+  The device procedure computes the checksum of the dirty rows only and
+  transfers a row if it differs from the content last sent, so clearing 
+  the frame and drawing the same picture again does not cause a transfer.
+
+  Universal 8bit Graphics Library
+  
+  Copyright (c) 2011, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, 
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list 
+    of conditions and the following disclaimer.
+    
+  * Redistributions in binary form must reproduce the above copyright notice, this 
+    list of conditions and the following disclaimer in the documentation and/or other 
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT 
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  
+  
+
+*/
+
+#include "u8g.h"
+
+
+void u8g_pb64v1_set_pixel(u8g_pb64v1_t *b, u8g_uint_t x, u8g_uint_t y, uint8_t color_index) U8G_NOINLINE;
+void u8g_pb64v1_SetPixel(u8g_pb64v1_t *b, const u8g_dev_arg_pixel_t * const arg_pixel) U8G_NOINLINE ;
+
+/* clear the complete frame, rows which had been set are marked as dirty */
+void u8g_pb64v1_Clear(u8g_pb64v1_t *b)
+{
+  uint8_t *ptr = (uint8_t *)b->pb.buf;
+  u8g_uint_t i;
+  uint8_t row = 0;
+  uint8_t mask = 1;
+  
+  for(;;)
+  {
+    i = b->pb.width;
+    do
+    {
+      if ( *ptr != 0 )
+      {
+        *ptr = 0;
+        b->dirty |= mask;
+      }
+      ptr++;
+      i--;
+    } while( i != 0 );
+    row += 8;
+    if ( row >= b->pb.p.total_height )
+      break;
+    mask <<= 1;
+  }
+}
+
+void u8g_pb64v1_set_pixel(u8g_pb64v1_t *b, u8g_uint_t x, u8g_uint_t y, uint8_t color_index)
+{
+  register uint8_t mask;
+  register uint8_t old;
+  uint8_t *ptr = b->pb.buf;
+  uint8_t row = y >> 3;
+  
+  ptr += x;
+  ptr += (u8g_uint_t)row * b->pb.width;
+  mask = 1;
+  y &= 0x07;
+  mask <<= y;
+  old = *ptr;
+  if ( color_index )
+  {
+    *ptr |= mask;
+  }
+  else
+  {
+    mask ^=0xff;
+    *ptr &= mask;
+  }
+  if ( *ptr != old )
+    b->dirty |= 1 << row;
+}
+
+
+void u8g_pb64v1_SetPixel(u8g_pb64v1_t *b, const u8g_dev_arg_pixel_t * const arg_pixel)
+{
+  if ( arg_pixel->y >= b->pb.p.total_height )
+    return;
+  if ( arg_pixel->x >= b->pb.width )
+    return;
+  u8g_pb64v1_set_pixel(b, arg_pixel->x, arg_pixel->y, arg_pixel->color);
+}
+
+void u8g_pb64v1_Set8PixelOpt2(u8g_pb64v1_t *b, u8g_dev_arg_pixel_t *arg_pixel)
+{
+  register uint8_t pixel = arg_pixel->pixel;
+  u8g_uint_t dx = 0;
+  u8g_uint_t dy = 0;
+  
+  switch( arg_pixel->dir )
+  {
+    case 0: dx++; break;
+    case 1: dy++; break;
+    case 2: dx--; break;
+    case 3: dy--; break;
+  }
+  
+  do
+  {
+    if ( pixel & 128 )
+      u8g_pb64v1_SetPixel(b, arg_pixel);
+    arg_pixel->x += dx;
+    arg_pixel->y += dy;
+    pixel <<= 1;
+  } while( pixel != 0  );
+  
+}
+
+uint8_t u8g_dev_pb64v1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+  u8g_pb64v1_t *fb = (u8g_pb64v1_t *)(dev->dev_mem);
+  u8g_pb_t *pb = &(fb->pb);
+  switch(msg)
+  {
+    case U8G_DEV_MSG_SET_8PIXEL:
+      if ( u8g_pb_Is8PixelVisible(pb, (u8g_dev_arg_pixel_t *)arg) )
+        u8g_pb64v1_Set8PixelOpt2(fb, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_PIXEL:
+        u8g_pb64v1_SetPixel(fb, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_INIT:
+      /* content of the display RAM is unknown: transfer everything once */
+      fb->dirty = 0x0ff;
+      u8g_pb_ResetSum(&(fb->sum));
+      break;
+    case U8G_DEV_MSG_STOP:
+      break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      /* keep the frame, only the changed parts are drawn again */
+      u8g_page_First(&(pb->p));
+      break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      if ( u8g_page_Next(&(pb->p)) == 0 )
+        return 0;
+      break;
+#ifdef U8G_DEV_MSG_IS_BBX_INTERSECTION
+    case U8G_DEV_MSG_IS_BBX_INTERSECTION:
+      return u8g_pb_IsIntersection(pb, (u8g_dev_arg_bbx_t *)arg);
+#endif
+    case U8G_DEV_MSG_GET_PAGE_BOX:
+      u8g_pb_GetPageBox(pb, (u8g_box_t *)arg);
+      break;
+    case U8G_DEV_MSG_GET_WIDTH:
+      *((u8g_uint_t *)arg) = pb->width;
+      break;
+    case U8G_DEV_MSG_GET_HEIGHT:
+      *((u8g_uint_t *)arg) = pb->p.total_height;
+      break;
+    case U8G_DEV_MSG_SET_COLOR_ENTRY:
+      break;
+    case U8G_DEV_MSG_SET_XY_CB:
+      break;
+    case U8G_DEV_MSG_GET_MODE:
+      return U8G_MODE_BW;
+  }
+  return 1;
+}
@@ -133,6 +133,55 @@ void u8g_pb8v1_Set8PixelOpt2(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel)
   
 }
 
+/* write a column major glyph directly into the page: each column needs at most two glyph bytes */
+void u8g_pb8v1_SetVGlyph(u8g_pb_t *b, u8g_dev_arg_vglyph_t *arg)
+{
+  const u8g_pgm_uint8_t *data = arg->data;
+  uint8_t *ptr = b->buf;
+  uint8_t bytes_per_col = (arg->h + 7) >> 3;
+  uint8_t i, mask;
+  int8_t shift;
+  u8g_int_t d;
+  u8g_uint_t x = arg->x;
+  
+  arg->is_done = 1;
+  
+  /* offset of the first glyph byte, which covers the page, relative to the page */
+  d = (u8g_int_t)(u8g_uint_t)(arg->y - b->p.page_y0);
+  while( d <= -8 )
+  {
+    d += 8;
+    data++;
+    bytes_per_col--;
+  }
+  if ( d >= 8 || bytes_per_col == 0 )
+    return;
+  shift = d;
+  
+  for( i = 0; i < arg->w; i++ )
+  {
+    if ( x < b->width )
+    {
+      if ( shift >= 0 )
+      {
+        mask = u8g_pgm_read(data) << shift;
+      }
+      else
+      {
+        mask = u8g_pgm_read(data) >> (-shift);
+        if ( bytes_per_col > 1 )
+          mask |= u8g_pgm_read(data+1) << (8+shift);
+      }
+      if ( arg->color )
+        ptr[x] |= mask;
+      else
+        ptr[x] &= ~mask;
+    }
+    data += (arg->h + 7) >> 3;
+    x++;
+  }
+}
+
 uint8_t u8g_dev_pb8v1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 {
   u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
@@ -145,6 +194,12 @@ uint8_t u8g_dev_pb8v1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg
     case U8G_DEV_MSG_SET_PIXEL:
         u8g_pb8v1_SetPixel(pb, (u8g_dev_arg_pixel_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_BOX:
+      u8g_pb_SetBoxV1(pb, (u8g_dev_arg_box_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_VGLYPH:
+      u8g_pb8v1_SetVGlyph(pb, (u8g_dev_arg_vglyph_t *)arg);
+      break;
     case U8G_DEV_MSG_INIT:
       break;
     case U8G_DEV_MSG_STOP:
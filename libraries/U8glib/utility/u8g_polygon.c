@@ -90,6 +90,10 @@ static void pge_Init(struct pg_edge_struct *pge, pg_word_t x1, pg_word_t y1, pg_
   pge->max_y = y2;
   pge->current_y = y1;
   pge->current_x = x1;
+  
+  /* horizontal edge: pge_Next() will not step, avoid the division */
+  if ( pge->height == 0 )
+    return;
 
   if ( dx >= 0 )
   {
@@ -108,6 +112,23 @@ static void pge_Init(struct pg_edge_struct *pge, pg_word_t x1, pg_word_t y1, pg_
   pge->error_offset = width % pge->height;
 }
 
+/* advance cnt scan lines at once, same result as cnt calls to pge_Next() (cnt <= max_y - current_y) */
+static void pge_Skip(struct pg_edge_struct *pge, pg_word_t cnt)
+{
+  int32_t error;
+  pg_word_t carry = 0;
+  
+  error = pge->error;
+  error += (int32_t)cnt * pge->error_offset;
+  if ( error > 0 )
+    carry = (error + pge->height - 1) / pge->height;
+  
+  pge->current_x += cnt * pge->current_x_offset;
+  pge->current_x += carry * pge->x_direction;
+  pge->error = error - (int32_t)carry * pge->height;
+  pge->current_y += cnt;
+}
+
 /*===========================================*/
 /* convex polygon algorithm */
 
@@ -195,6 +216,17 @@ static uint8_t pg_prepare(pg_struct *pg)
   return 1;
 }
 
+/* the span is sent directly to the device, the scan line is already inside the current page */
+static void pg_span(u8g_t *u8g, pg_word_t x, pg_word_t y, pg_word_t w)
+{
+  if ( w == 0 )
+    return;
+  if ( u8g_dl_IsRec(u8g) )
+    u8g_DrawHLine(u8g, x, y, w);
+  else
+    u8g_draw_hline(u8g, x, y, w);
+}
+
 static void pg_hline(pg_struct *pg, u8g_t *u8g)
 {
   pg_word_t x1, x2, y;
@@ -216,7 +248,7 @@ static void pg_hline(pg_struct *pg, u8g_t *u8g)
       x1 = 0;
     if ( x2 >= u8g_GetWidth(u8g) )
       x2 = u8g_GetWidth(u8g);
-    u8g_DrawHLine(u8g, x1, y, x2 - x1);
+    pg_span(u8g, x1, y, x2 - x1);
   }
   else
   {
@@ -225,10 +257,10 @@ static void pg_hline(pg_struct *pg, u8g_t *u8g)
     if ( x2 >= u8g_GetWidth(u8g) )
       return;
     if ( x2 < 0 )
-      x1 = 0;
+      x2 = 0;
     if ( x1 >= u8g_GetWidth(u8g) )
       x1 = u8g_GetWidth(u8g);
-    u8g_DrawHLine(u8g, x2, y, x1 - x2);
+    pg_span(u8g, x2, y, x1 - x2);
   }
 }
 
@@ -252,9 +284,30 @@ static void pg_line_init(pg_struct * pg, uint8_t pge_index)
   pge_Init(pge, x1, y1, x2, y2);
 }
 
+/* advance an edge by cnt scan lines, continue with the next edges of the polygon if required */
+static void pg_skip(pg_struct *pg, uint8_t pge_index, pg_word_t cnt)
+{
+  struct pg_edge_struct  *pge = pg->pge+pge_index;
+  pg_word_t k;
+  for(;;)
+  {
+    k = pge->max_y - pge->current_y;
+    if ( k >= cnt )
+      break;
+    if ( k > 0 )
+    {
+      pge_Skip(pge, k);
+      cnt -= k;
+    }
+    pg_line_init(pg, pge_index);
+  }
+  pge_Skip(pge, cnt);
+}
+
 static void pg_exec(pg_struct *pg, u8g_t *u8g)
 {
   pg_word_t i = pg->total_scan_line_cnt;
+  pg_word_t y, y0, y1;
 
   /* first line is skipped if the min y line is not flat */
   pg_line_init(pg, PG_LEFT);		
@@ -266,9 +319,30 @@ static void pg_exec(pg_struct *pg, u8g_t *u8g)
     pge_Next(&(pg->pge[PG_RIGHT]));
   }
 
-  do
+  /* only the scan lines of the current page are calculated */
+  y0 = u8g->current_page.y0;
+  y1 = u8g->current_page.y1;
+  y = pg->pge[PG_RIGHT].current_y;
+  if ( y < y0 )
+  {
+    if ( y0 - y >= i )
+      return;
+    i -= y0 - y;
+    pg_skip(pg, PG_LEFT, y0 - y);
+    pg_skip(pg, PG_RIGHT, y0 - y);
+    y = y0;
+  }
+  if ( y > y1 )
+    return;
+  if ( i > y1 - y + 1 )
+    i = y1 - y + 1;
+  
+  for(;;)
   {
     pg_hline(pg, u8g);
+    i--;
+    if ( i == 0 )
+      break;
     while ( pge_Next(&(pg->pge[PG_LEFT])) == 0 )
     {
       pg_line_init(pg, PG_LEFT);
@@ -277,8 +351,7 @@ static void pg_exec(pg_struct *pg, u8g_t *u8g)
     {
       pg_line_init(pg, PG_RIGHT);
     }
-    i--;
-  } while( i > 0 );
+  }
 }
 
 /*===========================================*/
@@ -293,19 +366,34 @@ void pg_AddPolygonXY(pg_struct *pg, u8g_t *u8g, int16_t x, int16_t y)
 {
   if ( pg->cnt < PG_MAX_POINTS )
   {
-    pg->list[pg->cnt].x = x;
-    pg->list[pg->cnt].y = y;
+    pg->points[pg->cnt].x = x;
+    pg->points[pg->cnt].y = y;
     pg->cnt++;
   }
 }
 
 void pg_DrawPolygon(pg_struct *pg, u8g_t *u8g)
 {
+  pg->list = pg->points;
   if ( pg_prepare(pg) == 0 )
     return;
   pg_exec(pg, u8g);
 }
 
+/* draw a polygon with the points of "list" (no copy, more than PG_MAX_POINTS are possible) */
+void pg_DrawPolygonList(pg_struct *pg, u8g_t *u8g, const struct pg_point_struct *list, uint8_t cnt)
+{
+  uint8_t points_cnt = pg->cnt;
+  if ( cnt >= 3 )
+  {
+    pg->list = list;
+    pg->cnt = cnt;
+    if ( pg_prepare(pg) != 0 )
+      pg_exec(pg, u8g);
+    pg->cnt = points_cnt;
+  }
+}
+
 pg_struct u8g_pg;
 
 void u8g_ClearPolygonXY(void)
@@ -323,6 +411,11 @@ void u8g_DrawPolygon(u8g_t *u8g)
   pg_DrawPolygon(&u8g_pg, u8g);
 }
 
+void u8g_DrawPolygonList(u8g_t *u8g, const struct pg_point_struct *list, uint8_t cnt)
+{
+  pg_DrawPolygonList(&u8g_pg, u8g, list, cnt);
+}
+
 void u8g_DrawTriangle(u8g_t *u8g, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 {
   u8g_ClearPolygonXY();
@@ -38,7 +38,7 @@
 
 #include "u8g.h"
 
-void u8g_draw_hline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
+static void u8g_draw_8pixel_hline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
 {
   uint8_t pixel = 0x0ff;
   while( w >= 8 )
@@ -56,7 +56,14 @@ void u8g_draw_hline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
   }
 }
 
-void u8g_draw_vline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t h)
+/* page buffers fill the span directly, all other devices get 8 pixel at a time */
+void u8g_draw_hline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
+{
+  if ( u8g_DrawBoxLL(u8g, u8g->dev, x, y, w, 1) == 0 )
+    u8g_draw_8pixel_hline(u8g, x, y, w);
+}
+
+static void u8g_draw_8pixel_vline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t h)
 {
   uint8_t pixel = 0x0ff;
   while( h >= 8 )
@@ -74,8 +81,19 @@ void u8g_draw_vline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t h)
   }
 }
 
+void u8g_draw_vline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t h)
+{
+  if ( u8g_DrawBoxLL(u8g, u8g->dev, x, y, 1, h) == 0 )
+    u8g_draw_8pixel_vline(u8g, x, y, h);
+}
+
 void u8g_DrawHLine(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
 {
+  if ( u8g_dl_IsRec(u8g) )
+  {
+    u8g_dl_RecBox(u8g, U8G_DL_OP_HLINE, x, y, w, 1);
+    return;
+  }
   if ( u8g_IsBBXIntersection(u8g, x, y, w, 1) == 0 )
     return;
   u8g_draw_hline(u8g, x, y, w);
@@ -83,6 +101,11 @@ void u8g_DrawHLine(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
 
 void u8g_DrawVLine(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
 {
+  if ( u8g_dl_IsRec(u8g) )
+  {
+    u8g_dl_RecBox(u8g, U8G_DL_OP_VLINE, x, y, w, 1);
+    return;
+  }
   if ( u8g_IsBBXIntersection(u8g, x, y, 1, w) == 0 )
     return;
   u8g_draw_vline(u8g, x, y, w);
@@ -93,6 +116,11 @@ void u8g_DrawFrame(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uin
 {
   u8g_uint_t xtmp = x;
   
+  if ( u8g_dl_IsRec(u8g) )
+  {
+    u8g_dl_RecBox(u8g, U8G_DL_OP_FRAME, x, y, w, h);
+    return;
+  }
   if ( u8g_IsBBXIntersection(u8g, x, y, w, h) == 0 )
     return;
 
@@ -109,9 +137,11 @@ void u8g_DrawFrame(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uin
 
 void u8g_draw_box(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h)
 {
+  if ( u8g_DrawBoxLL(u8g, u8g->dev, x, y, w, h) != 0 )
+    return;
   do
   { 
-    u8g_draw_hline(u8g, x, y, w);
+    u8g_draw_8pixel_hline(u8g, x, y, w);
     y++;    
     h--;
   } while( h != 0 );
@@ -120,6 +150,11 @@ void u8g_draw_box(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint
 /* restrictions: h > 0 */
 void u8g_DrawBox(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h)
 {
+  if ( u8g_dl_IsRec(u8g) )
+  {
+    u8g_dl_RecBox(u8g, U8G_DL_OP_BOX, x, y, w, h);
+    return;
+  }
   if ( u8g_IsBBXIntersection(u8g, x, y, w, h) == 0 )
     return;
   u8g_draw_box(u8g, x, y, w, h);
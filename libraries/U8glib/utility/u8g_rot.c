@@ -168,6 +168,12 @@ uint8_t u8g_dev_rot90_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
       }
       u8g_call_dev_fn(u8g, rotation_chain, msg, arg);
       break;
+    case U8G_DEV_MSG_SET_VGLYPH:
+      /* not rotated, the glyph is drawn with U8G_DEV_MSG_SET_8PIXEL instead */
+      break;
+    case U8G_DEV_MSG_SET_BOX:
+      /* not rotated, the box is drawn with U8G_DEV_MSG_SET_8PIXEL instead */
+      break;
     case U8G_DEV_MSG_SET_8PIXEL:
     case U8G_DEV_MSG_SET_4TPIXEL:
       {
@@ -272,6 +278,12 @@ uint8_t u8g_dev_rot180_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
       }
       u8g_call_dev_fn(u8g, rotation_chain, msg, arg);
       break;
+    case U8G_DEV_MSG_SET_VGLYPH:
+      /* not rotated, the glyph is drawn with U8G_DEV_MSG_SET_8PIXEL instead */
+      break;
+    case U8G_DEV_MSG_SET_BOX:
+      /* not rotated, the box is drawn with U8G_DEV_MSG_SET_8PIXEL instead */
+      break;
     case U8G_DEV_MSG_SET_8PIXEL:
     case U8G_DEV_MSG_SET_4TPIXEL:
       {
@@ -381,6 +393,12 @@ uint8_t u8g_dev_rot270_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
       }
       u8g_call_dev_fn(u8g, rotation_chain, msg, arg);
       break;
+    case U8G_DEV_MSG_SET_VGLYPH:
+      /* not rotated, the glyph is drawn with U8G_DEV_MSG_SET_8PIXEL instead */
+      break;
+    case U8G_DEV_MSG_SET_BOX:
+      /* not rotated, the box is drawn with U8G_DEV_MSG_SET_8PIXEL instead */
+      break;
     case U8G_DEV_MSG_SET_8PIXEL:
     case U8G_DEV_MSG_SET_4TPIXEL:
       {
@@ -111,6 +111,12 @@ uint8_t u8g_dev_scale_2x2_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
       ((u8g_dev_arg_pixel_t *)arg)->y = y;
       u8g_call_dev_fn(u8g, chain, msg, arg);    
       break;
+    case U8G_DEV_MSG_SET_VGLYPH:
+      /* not scaled, the glyph is drawn with U8G_DEV_MSG_SET_8PIXEL instead */
+      break;
+    case U8G_DEV_MSG_SET_BOX:
+      /* not scaled, the box is drawn with U8G_DEV_MSG_SET_8PIXEL instead */
+      break;
     case U8G_DEV_MSG_SET_8PIXEL:
       pixel = ((u8g_dev_arg_pixel_t *)arg)->pixel;
       dir = ((u8g_dev_arg_pixel_t *)arg)->dir;
@@ -113,6 +113,22 @@ uint8_t u8g_dev_vs_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 	return u8g_call_dev_fn(u8g_vs_list[u8g_vs_current].u8g, u8g_vs_list[u8g_vs_current].u8g->dev, msg, arg);
       }
       break;
+    case U8G_DEV_MSG_SET_VGLYPH:
+      if ( u8g_vs_current < u8g_vs_cnt )
+      {
+        ((u8g_dev_arg_vglyph_t *)arg)->x -= u8g_vs_list[u8g_vs_current].x;
+        ((u8g_dev_arg_vglyph_t *)arg)->y -= u8g_vs_list[u8g_vs_current].y;
+	return u8g_call_dev_fn(u8g_vs_list[u8g_vs_current].u8g, u8g_vs_list[u8g_vs_current].u8g->dev, msg, arg);
+      }
+      break;
+    case U8G_DEV_MSG_SET_BOX:
+      if ( u8g_vs_current < u8g_vs_cnt )
+      {
+        ((u8g_dev_arg_box_t *)arg)->x -= u8g_vs_list[u8g_vs_current].x;
+        ((u8g_dev_arg_box_t *)arg)->y -= u8g_vs_list[u8g_vs_current].y;
+	return u8g_call_dev_fn(u8g_vs_list[u8g_vs_current].u8g, u8g_vs_list[u8g_vs_current].u8g->dev, msg, arg);
+      }
+      break;
   }
   return 1;
 }